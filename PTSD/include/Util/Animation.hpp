@@ -39,6 +39,23 @@ public:
               std::size_t interval, bool looping = true,
               std::size_t cooldown = 100, bool useAA = true);
 
+    /**
+     * @brief Constructor for Animation class from already loaded frames.
+     *
+     * The frames are shared, not copied: several animations may hold the same
+     * Util::Image objects while keeping their own playback state.
+     *
+     * @param frames Loaded frames.
+     * @param play Whether the animation should play right away.
+     * @param interval Interval between frames in milliseconds.
+     * @param looping Whether the animation should loop.
+     * @param cooldown Cooldown time in milliseconds before the animation can
+     * restart.
+     */
+    Animation(std::vector<std::shared_ptr<Util::Image>> frames, bool play,
+              std::size_t interval, bool looping = true,
+              std::size_t cooldown = 100);
+
     /**
      * @brief Get the interval between frames.
      * @return Interval between frames in milliseconds.
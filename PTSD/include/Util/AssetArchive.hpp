@@ -0,0 +1,88 @@
+#ifndef UTIL_ASSET_ARCHIVE_HPP
+#define UTIL_ASSET_ARCHIVE_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include "Util/AssetArchiveFormat.hpp"
+
+namespace Util {
+/**
+ * @class AssetArchive
+ * @brief Read-only, memory mapped pack of asset files.
+ *
+ * Once mounted, files under the mounted root directory are served straight
+ * from the mapping instead of being opened one by one. Images are decoded
+ * with `IMG_Load_RW` over the mapped bytes, so nothing is copied before
+ * decoding. Paths that are not in the archive, or any path when no archive
+ * is mounted, fall back to the file system.
+ */
+class AssetArchive {
+public:
+    static AssetArchive &GetInstance();
+
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive &) = delete;
+    AssetArchive &operator=(const AssetArchive &) = delete;
+
+    /**
+     * @brief Map an archive built from `rootDirectory`.
+     * @param archivePath Archive file produced by AssetArchiveBuilder.
+     * @param rootDirectory Directory the archive was built from. Lookups
+     * strip this prefix from the requested path.
+     * @return Whether the archive was mapped and passed validation.
+     */
+    bool Mount(const std::string &archivePath,
+               const std::string &rootDirectory);
+    void Unmount();
+
+    bool IsMounted() const { return m_Data != nullptr; }
+    std::size_t GetEntryCount() const {
+        return m_Header ? m_Header->entryCount : 0;
+    }
+
+    /**
+     * @brief Look up a file.
+     * @param filepath Path on disk, under the mounted root directory.
+     * @return Pointer into the mapping and its size, or `{nullptr, 0}`.
+     */
+    std::pair<const void *, std::size_t>
+    Find(const std::string &filepath) const;
+
+    /**
+     * @brief Load an image, from the archive if possible.
+     * @return A new surface owned by the caller, or `nullptr` on failure.
+     */
+    SDL_Surface *LoadImageSurface(const std::string &filepath) const;
+
+    /**
+     * @brief Ask the OS to read everything under `directory` ahead of use.
+     *
+     * Files of one directory are stored contiguously, so this turns into one
+     * large sequential read.
+     */
+    void Prefetch(const std::string &directory) const;
+
+private:
+    std::string_view ToArchivePath(std::string_view filepath) const;
+    /**
+     * @brief Check once, at mount time, that every entry's path and data lie
+     * inside the mapping, so lookups can index the tables without checks.
+     */
+    bool ValidateTables() const;
+
+    const std::uint8_t *m_Data = nullptr;
+    std::size_t m_Size = 0;
+    const AssetArchiveFormat::Header *m_Header = nullptr;
+    const AssetArchiveFormat::Entry *m_Entries = nullptr;
+    const char *m_Paths = nullptr;
+    std::string m_RootDirectory;
+#ifdef _WIN32
+    void *m_FileHandle = nullptr;
+    void *m_MappingHandle = nullptr;
+#endif
+};
+} // namespace Util
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef UTIL_ASSET_ARCHIVE_FORMAT_HPP
+#define UTIL_ASSET_ARCHIVE_FORMAT_HPP
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief On-disk layout of an asset archive (little endian).
+ *
+ * [Header][Entry x entryCount, sorted by pathHash][path table][file data]
+ *
+ * Paths are stored relative to the archived root directory with forward
+ * slashes, e.g. "IcePlains/w601.png". File data is laid out in path order so
+ * everything under one directory is contiguous. Every blob starts on a
+ * `DATA_ALIGNMENT` boundary.
+ *
+ * This header has no dependencies so offline tools can include it without
+ * SDL or OpenGL.
+ */
+namespace Util::AssetArchiveFormat {
+constexpr std::uint32_t MAGIC = 0x41524B53; // "SKRA"
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint64_t DATA_ALIGNMENT = 16;
+
+struct Header {
+    std::uint32_t magic = MAGIC;
+    std::uint32_t version = VERSION;
+    std::uint32_t entryCount = 0;
+    std::uint32_t reserved = 0;
+    std::uint64_t entryTableOffset = 0;
+    std::uint64_t pathTableOffset = 0;
+    std::uint64_t pathTableSize = 0;
+};
+
+struct Entry {
+    std::uint64_t pathHash = 0;
+    std::uint64_t dataOffset = 0;
+    std::uint64_t dataSize = 0;
+    std::uint32_t pathOffset = 0;
+    std::uint32_t pathLength = 0;
+};
+
+static_assert(sizeof(Header) == 40 && sizeof(Entry) == 32,
+              "Asset archive layout must not depend on the compiler");
+
+/**
+ * @brief FNV-1a 64 bit hash of an archive path.
+ */
+constexpr std::uint64_t HashPath(std::string_view path) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c : path) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+} // namespace Util::AssetArchiveFormat
+
+#endif
@@ -63,6 +63,12 @@ public:
      */
     void Remove(const std::string &filepath);
 
+    /**
+     * @brief Store an asset that was loaded elsewhere.
+     * @note Keeps the existing asset if `filepath` is already stored.
+     */
+    void Insert(const std::string &filepath, T asset);
+
 private:
     std::function<T(const std::string &)> m_Loader;
 
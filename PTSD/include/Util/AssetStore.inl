@@ -22,4 +22,9 @@ template <typename T>
 void AssetStore<T>::Remove(const std::string &filepath) {
     m_Map.erase(filepath);
 }
+
+template <typename T>
+void AssetStore<T>::Insert(const std::string &filepath, T asset) {
+    m_Map.emplace(filepath, std::move(asset));
+}
 } // namespace Util
@@ -107,6 +107,13 @@ public:
      */
     void Resume();
 
+    /**
+     * @brief Drops the cached music opened from the given path.
+     * @param path The file path the music was opened from.
+     * @note The music is closed once no BGM refers to it anymore.
+     */
+    static void Release(const std::string &path);
+
 private:
     static Util::AssetStore<std::shared_ptr<Mix_Music>> s_Store;
 
@@ -76,6 +76,21 @@ public:
      */
     void Draw(const Core::Matrices &data) override;
 
+    /**
+     * @brief Hands an already decoded surface to the image cache.
+     *
+     * Lets surfaces be decoded on other threads ahead of time; an Image
+     * created later from the same path uploads it without touching the disk.
+     *
+     * @param filepath The path that will be passed to the constructor.
+     * @param surface The decoded surface.
+     *
+     * @note Must be called on the main thread. A path that is already cached
+     * keeps its surface.
+     */
+    static void CacheSurface(const std::string &filepath,
+                             std::shared_ptr<SDL_Surface> surface);
+
 private:
     void InitProgram();
     void InitVertexArray();
@@ -2,6 +2,7 @@
 #define UTIL_Renderer_HPP
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "Util/GameObject.hpp"
@@ -28,6 +29,8 @@ public:
      * @brief Add a child to Renderer.
      *
      * @param child The GameObject needing to be managed by Renderer.
+     *
+     * @note Adding a child that is already managed does nothing.
      */
     void AddChild(const std::shared_ptr<GameObject> &child);
 
@@ -39,7 +42,10 @@ public:
     void AddChildren(const std::vector<std::shared_ptr<GameObject>> &children);
 
     /**
-     * @brief Remove the child.
+     * @brief Remove the child in O(1).
+     *
+     * The last child is moved into the freed slot, so the insertion order is
+     * not kept. Draw order only depends on the z-index anyway.
      *
      * @param child The GameObject being removed.
      */
@@ -54,6 +60,7 @@ public:
 
 private:
     std::vector<std::shared_ptr<GameObject>> m_Children;
+    std::unordered_map<const GameObject *, std::size_t> m_ChildIndices;
 };
 } // namespace Util
 
@@ -76,8 +76,10 @@ public:
      * @param duration The duration of the sound effect in milliseconds. <br>
      *                            A value of -1 means it will play the entire
      * sound effect.
+     * @return The mixer channel the sound effect is playing on, or -1 if no
+     * channel was available.
      */
-    void Play(int loop = 0, int duration = -1);
+    int Play(int loop = 0, int duration = -1);
 
     /**
      * @brief Fades in the sound effect gradually.
@@ -88,8 +90,17 @@ public:
      * @param duration The duration of the sound effect in milliseconds.<br>
      *                            A value of -1 means it will play the entire
      * sound effect.
+     * @return The mixer channel the sound effect is playing on, or -1 if no
+     * channel was available.
      */
-    void FadeIn(unsigned int tick, int oop = -1, unsigned int duration = -1);
+    int FadeIn(unsigned int tick, int oop = -1, unsigned int duration = -1);
+
+    /**
+     * @brief Drops the cached chunk loaded from the given path.
+     * @param path The file path the chunk was loaded from.
+     * @note The decoded audio is freed once no SFX refers to it anymore.
+     */
+    static void Release(const std::string &path);
 
 private:
     static Util::AssetStore<std::shared_ptr<Mix_Chunk>> s_Store;
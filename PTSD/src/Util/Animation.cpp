@@ -16,6 +16,15 @@ Animation::Animation(const std::vector<std::string> &paths, bool play,
     }
 }
 
+Animation::Animation(std::vector<std::shared_ptr<Util::Image>> frames,
+                     bool play, std::size_t interval, bool looping,
+                     std::size_t cooldown)
+    : m_Frames(std::move(frames)),
+      m_State(play ? State::PLAY : State::PAUSE),
+      m_Interval(interval),
+      m_Looping(looping),
+      m_Cooldown(cooldown) {}
+
 void Animation::UseAntiAliasing(bool useAA) {
     for (const auto &frame : m_Frames) {
         frame->UseAntiAliasing(useAA);
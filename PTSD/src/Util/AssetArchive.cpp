@@ -0,0 +1,234 @@
+#include "Util/AssetArchive.hpp"
+
+#include "Util/Logger.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Util {
+using namespace AssetArchiveFormat;
+
+namespace {
+// `offset + size <= limit` without the addition wrapping around
+bool Fits(std::uint64_t offset, std::uint64_t size, std::uint64_t limit) {
+    return offset <= limit && size <= limit - offset;
+}
+} // namespace
+
+AssetArchive &AssetArchive::GetInstance() {
+    static AssetArchive instance;
+    return instance;
+}
+
+AssetArchive::~AssetArchive() {
+    Unmount();
+}
+
+bool AssetArchive::Mount(const std::string &archivePath,
+                         const std::string &rootDirectory) {
+    Unmount();
+#ifdef _WIN32
+    const HANDLE file =
+        CreateFileA(archivePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    const HANDLE mapping =
+        GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0
+            ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)
+            : nullptr;
+    const void *view =
+        mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        return false;
+    }
+    m_FileHandle = file;
+    m_MappingHandle = mapping;
+    m_Size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(archivePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info {};
+    void *view = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    m_Size = static_cast<std::size_t>(info.st_size);
+#endif
+    m_Data = static_cast<const std::uint8_t *>(view);
+    m_Header = reinterpret_cast<const Header *>(m_Data);
+
+    bool valid =
+        m_Size >= sizeof(Header) && m_Header->magic == MAGIC &&
+        m_Header->version == VERSION &&
+        m_Header->entryTableOffset % alignof(Entry) == 0 &&
+        m_Header->entryCount <= m_Size / sizeof(Entry) &&
+        Fits(m_Header->entryTableOffset,
+             std::uint64_t{m_Header->entryCount} * sizeof(Entry), m_Size) &&
+        Fits(m_Header->pathTableOffset, m_Header->pathTableSize, m_Size);
+    if (valid) {
+        m_Entries = reinterpret_cast<const Entry *>(m_Data +
+                                                    m_Header->entryTableOffset);
+        m_Paths =
+            reinterpret_cast<const char *>(m_Data + m_Header->pathTableOffset);
+        valid = ValidateTables();
+    }
+    if (!valid) {
+        LOG_WARN("'{}' is not a valid version {} asset archive, reading loose "
+                 "files instead",
+                 archivePath, VERSION);
+        Unmount();
+        return false;
+    }
+    m_RootDirectory = rootDirectory;
+    LOG_INFO("Mounted asset archive '{}' ({} files)", archivePath,
+             m_Header->entryCount);
+    return true;
+}
+
+bool AssetArchive::ValidateTables() const {
+    for (std::uint32_t i = 0; i < m_Header->entryCount; ++i) {
+        const Entry &entry = m_Entries[i];
+        if (!Fits(entry.pathOffset, entry.pathLength,
+                  m_Header->pathTableSize) ||
+            !Fits(entry.dataOffset, entry.dataSize, m_Size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetArchive::Unmount() {
+    if (m_Data != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_Data);
+        CloseHandle(m_MappingHandle);
+        CloseHandle(m_FileHandle);
+        m_MappingHandle = nullptr;
+        m_FileHandle = nullptr;
+#else
+        munmap(const_cast<std::uint8_t *>(m_Data), m_Size);
+#endif
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Header = nullptr;
+    m_Entries = nullptr;
+    m_Paths = nullptr;
+    m_RootDirectory.clear();
+}
+
+std::string_view AssetArchive::ToArchivePath(std::string_view filepath) const {
+    if (filepath.substr(0, m_RootDirectory.size()) != m_RootDirectory) {
+        return {};
+    }
+    filepath.remove_prefix(m_RootDirectory.size());
+    while (!filepath.empty() &&
+           (filepath.front() == '/' || filepath.front() == '\\')) {
+        filepath.remove_prefix(1);
+    }
+    return filepath;
+}
+
+std::pair<const void *, std::size_t>
+AssetArchive::Find(const std::string &filepath) const {
+    if (m_Data == nullptr) {
+        return {nullptr, 0};
+    }
+    const std::string_view path = ToArchivePath(filepath);
+    if (path.empty()) {
+        return {nullptr, 0};
+    }
+
+    const std::uint64_t hash = HashPath(path);
+    const Entry *end = m_Entries + m_Header->entryCount;
+    const Entry *it = std::lower_bound(
+        m_Entries, end, hash, [](const Entry &entry, std::uint64_t value) {
+            return entry.pathHash < value;
+        });
+    for (; it != end && it->pathHash == hash; ++it) {
+        // Mount already checked that every entry lies inside the mapping
+        if (std::string_view(m_Paths + it->pathOffset, it->pathLength) ==
+            path) {
+            return {m_Data + it->dataOffset,
+                    static_cast<std::size_t>(it->dataSize)};
+        }
+    }
+    return {nullptr, 0};
+}
+
+SDL_Surface *AssetArchive::LoadImageSurface(const std::string &filepath) const {
+    if (const auto [data, size] = Find(filepath); data != nullptr) {
+        // SDL_RWFromConstMem reads the mapping in place; freesrc = 1 closes
+        // the RWops (not the mapping) once decoding is done.
+        if (SDL_RWops *rw =
+                SDL_RWFromConstMem(data, static_cast<int>(size))) {
+            return IMG_Load_RW(rw, 1);
+        }
+    }
+    return IMG_Load(filepath.c_str());
+}
+
+void AssetArchive::Prefetch(const std::string &directory) const {
+    if (m_Data == nullptr) {
+        return;
+    }
+    std::string prefix(ToArchivePath(directory));
+    if (prefix.empty()) {
+        prefix = directory;
+    }
+    if (prefix.back() != '/') {
+        prefix.push_back('/');
+    }
+
+    // Data is stored in path order, so the directory is one contiguous range
+    std::uint64_t begin = m_Size;
+    std::uint64_t end = 0;
+    for (std::uint32_t i = 0; i < m_Header->entryCount; ++i) {
+        const Entry &entry = m_Entries[i];
+        const std::string_view path(m_Paths + entry.pathOffset,
+                                    entry.pathLength);
+        if (path.substr(0, prefix.size()) == prefix) {
+            begin = std::min(begin, entry.dataOffset);
+            end = std::max(end, entry.dataOffset + entry.dataSize);
+        }
+    }
+    if (begin >= end || end > m_Size) {
+        return;
+    }
+#ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<std::uint8_t *>(m_Data + begin);
+    range.NumberOfBytes = static_cast<SIZE_T>(end - begin);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    // madvise wants a page aligned start
+    const auto pageSize = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+    const std::uint64_t alignedBegin = begin / pageSize * pageSize;
+    madvise(const_cast<std::uint8_t *>(m_Data + alignedBegin),
+            static_cast<std::size_t>(end - alignedBegin), MADV_WILLNEED);
+#endif
+}
+} // namespace Util
@@ -59,6 +59,10 @@ void BGM::Resume() {
     Mix_ResumeMusic();
 }
 
+void BGM::Release(const std::string &path) {
+    s_Store.Remove(path);
+}
+
 Util::AssetStore<std::shared_ptr<Mix_Music>> BGM::s_Store(LoadMusic);
 
 } // namespace Util
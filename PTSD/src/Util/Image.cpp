@@ -1,5 +1,6 @@
 #include "Util/Image.hpp"
 
+#include "Util/AssetArchive.hpp"
 #include "Util/Logger.hpp"
 #include "pch.hpp"
 
@@ -11,8 +12,9 @@
 #include <glm/fwd.hpp>
 
 std::shared_ptr<SDL_Surface> LoadSurface(const std::string &filepath) {
-    auto surface = std::shared_ptr<SDL_Surface>(IMG_Load(filepath.c_str()),
-                                                SDL_FreeSurface);
+    auto surface = std::shared_ptr<SDL_Surface>(
+        Util::AssetArchive::GetInstance().LoadImageSurface(filepath),
+        SDL_FreeSurface);
 
     if (surface == nullptr) {
         surface = {Util::GetMissingImageTextureSDLSurface(), SDL_FreeSurface};
@@ -58,6 +60,13 @@ void Image::SetImage(const std::string &filepath) {
     m_Size = {surface->w, surface->h};
 }
 
+void Image::CacheSurface(const std::string &filepath,
+                         std::shared_ptr<SDL_Surface> surface) {
+    if (surface != nullptr) {
+        s_Store.Insert(filepath, std::move(surface));
+    }
+}
+
 void Image::UseAntiAliasing(bool useAA) {
     m_Texture->UseAntiAliasing(useAA);
 }
@@ -5,22 +5,40 @@
 #include "Util/Logger.hpp"
 
 namespace Util {
-Renderer::Renderer(const std::vector<std::shared_ptr<GameObject>> &children)
-    : m_Children(children) {}
+Renderer::Renderer(const std::vector<std::shared_ptr<GameObject>> &children) {
+    AddChildren(children);
+}
 
 void Renderer::AddChild(const std::shared_ptr<GameObject> &child) {
+    if (!m_ChildIndices.emplace(child.get(), m_Children.size()).second) {
+        return;
+    }
     m_Children.push_back(child);
 }
 
 void Renderer::RemoveChild(std::shared_ptr<GameObject> child) {
-    m_Children.erase(std::remove(m_Children.begin(), m_Children.end(), child),
-                     m_Children.end());
+    const auto it = m_ChildIndices.find(child.get());
+    if (it == m_ChildIndices.end()) {
+        return;
+    }
+
+    const std::size_t index = it->second;
+    m_ChildIndices.erase(it);
+
+    // swap-and-pop
+    if (index != m_Children.size() - 1) {
+        m_Children[index] = std::move(m_Children.back());
+        m_ChildIndices[m_Children[index].get()] = index;
+    }
+    m_Children.pop_back();
 }
 
 void Renderer::AddChildren(
     const std::vector<std::shared_ptr<GameObject>> &children) {
     m_Children.reserve(m_Children.size() + children.size());
-    m_Children.insert(m_Children.end(), children.begin(), children.end());
+    for (const auto &child : children) {
+        AddChild(child);
+    }
 }
 
 void Renderer::Update() {
@@ -39,13 +39,18 @@ void SFX::VolumeDown(const int step) {
     int volume = GetVolume();
     SetVolume(volume - step);
 }
-void SFX::Play(const int loop, const int duration) {
-    Mix_PlayChannelTimed(-1, m_Chunk.get(), loop, duration);
+int SFX::Play(const int loop, const int duration) {
+    return Mix_PlayChannelTimed(-1, m_Chunk.get(), loop, duration);
 }
-void SFX::FadeIn(const unsigned int tick, const int loop,
-                 const unsigned int duration) {
-    Mix_FadeInChannelTimed(-1, m_Chunk.get(), loop, static_cast<int>(tick),
-                           static_cast<int>(duration));
+int SFX::FadeIn(const unsigned int tick, const int loop,
+                const unsigned int duration) {
+    return Mix_FadeInChannelTimed(-1, m_Chunk.get(), loop,
+                                  static_cast<int>(tick),
+                                  static_cast<int>(duration));
+}
+
+void SFX::Release(const std::string &path) {
+    s_Store.Remove(path);
 }
 
 Util::AssetStore<std::shared_ptr<Mix_Chunk>> SFX::s_Store(LoadChunk);
@@ -3,10 +3,15 @@ set(SRC_FILES
     App.cpp
     Attack/Attack.cpp
     Attack/AttackManager.cpp
+    Attack/AttackPoolConfig.cpp
+    Attack/BossPattern.cpp
+    Attack/BulletBatchDrawable.cpp
+    Attack/BulletSystem.cpp
     Attack/EffectAttack.cpp
     Attack/EffectAttackPool.cpp
     Attack/Projectile.cpp
     Attack/ProjectilePool.cpp
+    Attack/TargetPredictor.cpp
     Beacon.cpp
     Camera.cpp
     CollisionComponentStruct.cpp
@@ -19,6 +24,7 @@ set(SRC_FILES
     Components/DoorComponent.cpp
     Components/DropComponent.cpp
     Components/EnemyAI/AttackStrategy.cpp
+    Components/EnemyAI/BehaviorTree.cpp
     Components/EnemyAI/MoveStrategy.cpp
     Components/FlickerComponent.cpp
     Components/FollowerComponent.cpp
@@ -32,6 +38,7 @@ set(SRC_FILES
     Components/SpikeComponent.cpp
     Components/StateComponent.cpp
     Components/TalentComponent.cpp
+    ContentHotReload.cpp
     Creature/Character.cpp
     Cursor.cpp
     DestructionEffects/ExplosionEffect.cpp
@@ -47,12 +54,16 @@ set(SRC_FILES
     ObserveManager/AudioManager.cpp
     ObserveManager/InputManager.cpp
     ObserveManager/TrackingManager.cpp
+    Room/AIScheduler.cpp
     Room/BossRoom.cpp
     Room/ChestRoom.cpp
     Room/CollisionOptimizer.cpp
+    Room/CrowdSeparation.cpp
     Room/DungeonMap.cpp
     Room/DungeonRoom.cpp
     Room/DungeonRoom_CollisionOptimization.cpp
+    Room/GridFlowField.cpp
+    Room/GridPathfinder.cpp
     Room/LobbyRoom.cpp
     Room/MonsterRoom.cpp
     Room/MonsterRoomTestUI.cpp
@@ -61,7 +72,9 @@ set(SRC_FILES
     Room/RoomCollisionManager.cpp
     Room/RoomInteractionManager.cpp
     Room/RoomLayoutManager.cpp
+    Room/RoomPrefabCache.cpp
     Room/ShopRoom.cpp
+    Room/SpawnAreaTable.cpp
     Room/SpecialRoom.cpp
     Room/StartingRoom.cpp
     Room/UniformGrid.cpp
@@ -102,7 +115,12 @@ set(SRC_FILES
     UIPanel/UIManager.cpp
     UIPanel/UIPanel.cpp
     UIPanel/UISlider.cpp
+    Util/AssetPreloader.cpp
+    Util/ContentPack.cpp
+    Util/FileWatcher.cpp
+    Util/StartupTrace.cpp
     Util/Timer.cpp
+    Util/WorkStealingPool.cpp
     Weapon/GunWeapon.cpp
     Weapon/MeleeWeapon.cpp
     Weapon/Weapon.cpp
@@ -115,10 +133,16 @@ set(INCLUDE_FILES
     App.hpp
     Attack/Attack.hpp
     Attack/AttackManager.hpp
+    Attack/AttackPool.hpp
+    Attack/AttackPoolConfig.hpp
+    Attack/BossPattern.hpp
+    Attack/BulletBatchDrawable.hpp
+    Attack/BulletSystem.hpp
     Attack/EffectAttack.hpp
     Attack/EffectAttackPool.hpp
     Attack/Projectile.hpp
     Attack/ProjectilePool.hpp
+    Attack/TargetPredictor.hpp
     Beacon.hpp
     Camera.hpp
     Components/AiComponent.hpp
@@ -134,6 +158,7 @@ set(INCLUDE_FILES
     Components/DropComponent.hpp
     Components/EffectAttackComponent.hpp
     Components/EnemyAI/AttackStrategy.hpp
+    Components/EnemyAI/BehaviorTree.hpp
     Components/EnemyAI/MoveStrategy.hpp
     Components/EnemyAI/UtilityStrategy.hpp
     Components/FlickerComponent.hpp
@@ -150,6 +175,7 @@ set(INCLUDE_FILES
     Components/TalentComponet.hpp
     Components/TriggerComponent.hpp
     Components/walletComponent.hpp
+    ContentHotReload.hpp
     Creature/Character.hpp
     Cursor.hpp
     DestructionEffects/ExplosionEffect.hpp
@@ -176,11 +202,15 @@ set(INCLUDE_FILES
     Observer.hpp
     Override/nGameObject.hpp
     RandomUtil.hpp
+    Room/AIScheduler.hpp
     Room/BossRoom.hpp
     Room/ChestRoom.hpp
     Room/CollisionOptimizer.hpp
+    Room/CrowdSeparation.hpp
     Room/DungeonMap.hpp
     Room/DungeonRoom.hpp
+    Room/GridFlowField.hpp
+    Room/GridPathfinder.hpp
     Room/LobbyRoom.hpp
     Room/MonsterRoom.hpp
     Room/MonsterRoomTestUI.hpp
@@ -189,7 +219,9 @@ set(INCLUDE_FILES
     Room/RoomCollisionManager.hpp
     Room/RoomInteractionManager.hpp
     Room/RoomLayoutManager.hpp
+    Room/RoomPrefabCache.hpp
     Room/ShopRoom.hpp
+    Room/SpawnAreaTable.hpp
     Room/SpecialRoom.hpp
     Room/StartingRoom.hpp
     Room/UniformGrid.hpp
@@ -219,6 +251,7 @@ set(INCLUDE_FILES
     Structs/InteractionComponentStruct.hpp
     Structs/KnockOffEventInfo.hpp
     Structs/NPCComponentStruct.hpp
+    Structs/ObjectDataStruct.hpp
     Structs/PositionChangedEvent.hpp
     Structs/RectShape.hpp
     Structs/ReflectProjectileEventInfo.hpp
@@ -245,7 +278,14 @@ set(INCLUDE_FILES
     UIPanel/UIManager.hpp
     UIPanel/UIPanel.hpp
     UIPanel/UISlider.hpp
+    Util/AssetPreloader.hpp
+    Util/ContentPack.hpp
+    Util/FileWatcher.hpp
+    Util/MpscRingBuffer.hpp
+    Util/StartupTrace.hpp
     Util/Timer.hpp
+    Util/WeakIndexedList.hpp
+    Util/WorkStealingPool.hpp
     Weapon/GunWeapon.hpp
     Weapon/MeleeWeapon.hpp
     Weapon/Weapon.hpp
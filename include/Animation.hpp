@@ -13,6 +13,9 @@ class Animation : public nGameObject
 public:
 	Animation(const std::vector<std::string> &AnimationPaths, bool needLoop,
 			  float interval = 0, const std::string &_class = "Animation");
+	// 共用已載入的幀（同種敵人共用一組Util::Image，只有播放狀態是各自的）
+	Animation(std::vector<std::shared_ptr<Util::Image>> frames, bool needLoop, float interval = 0,
+			  const std::string &_class = "Animation");
 	~Animation() override = default;
 
 	// 禁用拷贝构造和拷贝赋值
@@ -42,6 +45,9 @@ public:
 	void PlayAnimation(bool play);
 
 private:
+	// interval爲0時依幀數決定播放速度
+	static float DefaultInterval(size_t frameCount);
+
 	std::vector<std::string> m_AnimationPaths; // 動畫幀列表
 	bool m_Looping;
 };
@@ -5,14 +5,26 @@
 #ifndef ATTACKMANAGER_HPP
 #define ATTACKMANAGER_HPP
 
+#include <mutex>
+#include "Attack/AttackPoolConfig.hpp"
+#include "Attack/BulletSystem.hpp"
 #include "Attack/EffectAttackPool.hpp"
 #include "Attack/ProjectilePool.hpp"
 #include "ObserveManager/IManager.hpp"
+#include "Util/MpscRingBuffer.hpp"
+
+// 批次生成時每顆子彈各自的部分，其餘欄位沿用樣板
+struct AttackShot
+{
+	glm::vec2 position = glm::vec2(0.0f);
+	glm::vec2 direction = glm::vec2(0.0f);
+	float rotation = 0.0f;
+};
 
 class AttackManager : public IManager{
 public:
-	// 构造函数与析构函数
-	AttackManager() = default;
+	// 构造函数与析构函数（物件池依設定暖機，每個場景各自一份）
+	explicit AttackManager(const AttackPoolConfig& poolConfig = AttackPoolConfig::FromContentConfig());
 	~AttackManager() override= default;
 
 	// 禁止拷贝与赋值
@@ -25,26 +37,42 @@ public:
 	//----Getter----
 	const std::vector<std::shared_ptr<Projectile>>& GetProjectiles() const { return m_projectiles; }
 	const std::vector<std::shared_ptr<EffectAttack>>& GetEffects() const { return m_effects; }
+	const BulletSystem& GetBulletSystem() const { return m_bulletSystem; }
+	const AttackPoolStats& GetProjectilePoolStats() const { return m_projectilePool.GetStats(); }
+	const AttackPoolStats& GetEffectPoolStats() const { return m_effectPool.GetStats(); }
 
-	// Bubble延緩加入->否則一邊更新一邊加入vector，會導致迭代器/引用失效
-	void EnqueueSpawn(std::function<void()> spawnFunc) {
-		m_spawnQueue.push_back(std::move(spawnFunc));
-	}
 	// 射出子彈類 OR 斬擊動畫
+	// 只把生成請求寫進佇列，延遲到Update開頭統一生成->否則一邊更新一邊加入vector，會導致迭代器/引用失效
+	// 可在任意執行緒呼叫（AI/武器的平行更新）
 	void spawnProjectile(const ProjectileInfo& projectileInfo);
 	void spawnEffectAttack(const EffectAttackInfo &effectAttackInfo);
+	// 同一個樣板一次生成多顆（Boss彈幕），直接寫進佇列槽位，不必先複製出每一顆的Info
+	void spawnProjectileBatch(const ProjectileInfo& prototype, const std::vector<AttackShot>& shots);
 
 
 private:
-	std::vector<std::function<void()>> m_spawnQueue;		// 收集這回合更新時新增的子彈(bubble)
-	std::vector<std::shared_ptr<Projectile>> m_projectiles;
-	std::deque<std::shared_ptr<Projectile>> m_projectileRemovalQueue;
+	static constexpr size_t PROJECTILE_SPAWN_CAPACITY = 1024;
+	static constexpr size_t EFFECT_SPAWN_CAPACITY = 256;
 
+	void ProcessSpawnQueue();
+	void SpawnProjectileNow(const ProjectileInfo& projectileInfo);
+	void SpawnEffectAttackNow(const EffectAttackInfo &effectAttackInfo);
+
+	// 預先配置的生成請求環形佇列（多生產者無鎖，主執行緒每幀消化一次）
+	Util::MpscRingBuffer<ProjectileInfo, PROJECTILE_SPAWN_CAPACITY> m_projectileSpawnQueue;
+	Util::MpscRingBuffer<EffectAttackInfo, EFFECT_SPAWN_CAPACITY> m_effectSpawnQueue;
+	// 環形佇列滿了才會用到的備援（極少發生，不丟棄任何請求）
+	std::mutex m_overflowMutex;
+	std::vector<ProjectileInfo> m_projectileSpawnOverflow;
+	std::vector<EffectAttackInfo> m_effectSpawnOverflow;
+
+	// 一般子彈走SoA模擬，只有特殊子彈才建立Projectile物件
+	BulletSystem m_bulletSystem;
+	std::vector<std::shared_ptr<Projectile>> m_projectiles;
 	std::vector<std::shared_ptr<EffectAttack>> m_effects;
-	std::deque<std::shared_ptr<EffectAttack>> m_effectRemovalQueue;
 
 	ProjectilePool m_projectilePool;
-	EffectAttackPool m_effectPool; // 用于多线程保护
+	EffectAttackPool m_effectPool;
 };
 
 #endif //ATTACKMANAGER_HPP
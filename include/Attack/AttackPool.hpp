@@ -0,0 +1,95 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef ATTACKPOOL_HPP
+#define ATTACKPOOL_HPP
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "Util/Logger.hpp"
+
+// 物件池的統計資料（調試介面用來調整暖機數量）
+struct AttackPoolStats
+{
+	size_t prewarmed = 0;		// 暖機建立的數量
+	size_t created = 0;			// 總共建立的數量（暖機 + 擴充）
+	size_t inUse = 0;			// 目前借出的數量
+	size_t highWaterMark = 0;	// 同時借出的最高數量
+	size_t growCount = 0;		// 池子被借光而擴充的次數
+};
+
+/**
+ * @brief 攻擊物件（Projectile/EffectAttack）共用的物件池
+ *
+ * 每個AttackManager（也就是每個場景）各自擁有，不再跨場景共用static deque。
+ * 建構時一次暖機到目標數量；真的被借光時一次擴充一整批，而不是每次Acquire都make_shared，
+ * 並記錄在統計裏，方便回頭調整暖機目標。
+ * @tparam T 攻擊物件型別，需提供ResetAll(InfoT)
+ * @tparam InfoT 建立/重置用的資訊型別
+ */
+template <typename T, typename InfoT>
+class AttackPool
+{
+public:
+	AttackPool(const InfoT &warmupInfo, const size_t prewarmCount, const size_t growStep) :
+		m_warmupInfo(warmupInfo), m_growStep(std::max<size_t>(growStep, 1))
+	{
+		Grow(prewarmCount);
+		m_stats.prewarmed = prewarmCount;
+	}
+	virtual ~AttackPool() = default;
+
+	AttackPool(const AttackPool &) = delete;
+	AttackPool &operator=(const AttackPool &) = delete;
+
+	std::shared_ptr<T> Acquire(const InfoT &info)
+	{
+		if (m_free.empty())
+		{
+			Grow(m_growStep);
+			m_stats.growCount++;
+			LOG_WARN("AttackPool exhausted (high-water {}), grew to {}", m_stats.highWaterMark, m_stats.created);
+		}
+
+		auto object = std::move(m_free.back());
+		m_free.pop_back();
+		object->ResetAll(info);
+		object->SetActive(true);
+		object->SetControlVisible(true);
+
+		m_stats.inUse++;
+		m_stats.highWaterMark = std::max(m_stats.highWaterMark, m_stats.inUse);
+		return object;
+	}
+
+	void Release(const std::shared_ptr<T> &object)
+	{
+		if (!object)
+			return;
+		m_free.push_back(object);
+		if (m_stats.inUse > 0)
+			m_stats.inUse--;
+	}
+
+	//----Getter----
+	[[nodiscard]] const AttackPoolStats &GetStats() const { return m_stats; }
+	[[nodiscard]] size_t GetAvailable() const { return m_free.size(); }
+
+private:
+	void Grow(const size_t count)
+	{
+		m_free.reserve(m_stats.created + count);
+		for (size_t i = 0; i < count; ++i)
+			m_free.push_back(std::make_shared<T>(m_warmupInfo));
+		m_stats.created += count;
+	}
+
+	InfoT m_warmupInfo;
+	size_t m_growStep;
+	std::vector<std::shared_ptr<T>> m_free;
+	AttackPoolStats m_stats;
+};
+
+#endif //ATTACKPOOL_HPP
@@ -0,0 +1,26 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef ATTACKPOOLCONFIG_HPP
+#define ATTACKPOOLCONFIG_HPP
+
+#include <cstddef>
+
+// AttackManager物件池的暖機設定
+struct AttackPoolConfig
+{
+	size_t projectilePrewarm = 32;
+	size_t effectPrewarm = 32;
+	size_t growStep = 16; // 池子被借光時一次擴充的數量
+
+	/**
+	 * @brief 依json/weapon.json與json/enemy.json推算的暖機目標（整個程式只算一次）
+	 *
+	 * 每把武器的需求 = 每秒生成數 * 存活時間；玩家取最耗的一把武器，
+	 * 每種持武器的敵人假設同時出現ENEMY_INSTANCES_PER_TYPE隻，Boss另外保留固定額度。
+	 */
+	static const AttackPoolConfig &FromContentConfig();
+};
+
+#endif //ATTACKPOOLCONFIG_HPP
@@ -0,0 +1,99 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef BOSSPATTERN_HPP
+#define BOSSPATTERN_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Attack/AttackManager.hpp"
+#include "Attack/EffectAttack.hpp"
+#include "Attack/Projectile.hpp"
+#include "json.hpp"
+
+// 彈幕裏的一種子彈/特效/召喚（json的bullets）
+struct BossBulletTemplate
+{
+	enum class Kind : uint8_t { PROJECTILE, EFFECT_ATTACK, SUMMON };
+
+	Kind kind = Kind::PROJECTILE;
+	ProjectileInfo projectile;
+	EffectAttackInfo effect;
+	int summonEnemyId = -1;
+	glm::vec2 offset = glm::vec2(0.0f); // 相對Boss的固定生成偏移
+	bool alignRotation = false;			// 圖片轉向飛行方向
+	bool chainSelf = false;				// 持續延伸的特效：連鎖資訊每次發射都要各自一份
+};
+
+// 預先算好方向的一顆子彈，aim爲target時相對於朝向目標的方向再旋轉
+struct BossPatternShot
+{
+	glm::vec2 direction;
+	float angle; // 弧度，與direction一致，旋轉圖片用
+};
+
+// 某個時間點要發射的一批子彈
+struct BossPatternEmission
+{
+	float time;			// 技能開始後幾秒
+	uint16_t bullet;	// BossPatternLibrary的子彈樣板索引
+	uint16_t firstShot; // skill.shots裏的起點
+	uint16_t shotCount;
+	float radius;		// 沿方向往外的生成距離
+	bool aimAtTarget;
+};
+
+// 一個技能編譯後的發射表（依時間排序）
+struct BossPatternSkill
+{
+	float cooldown = 0.0f;
+	float duration = 0.0f;
+	float castTime = 0.0f;
+	std::vector<BossPatternEmission> emissions;
+	std::vector<BossPatternShot> shots;
+};
+
+/**
+ * @brief Boss彈幕引擎：json/bossPattern.json 描述子彈樣板與每個技能的發射器（扇形、環形、螺旋、時間軸），
+ * 載入時一次編譯成依時間排序的發射表，每顆子彈的方向都先算好；
+ * 執行時只要依經過時間依序取出發射項目，把整批子彈一次寫進AttackManager。
+ * 新的Boss招式只需要改json。
+ */
+class BossPatternLibrary
+{
+public:
+	using SummonFunc = std::function<void(int enemyId, const glm::vec2 &position)>;
+
+	// 整個程式只載入/編譯一次
+	static const BossPatternLibrary &GetInstance();
+
+	explicit BossPatternLibrary(const nlohmann::json &data);
+
+	[[nodiscard]] const BossPatternSkill *FindSkill(const std::string &name) const;
+
+	/**
+	 * @brief 發射一個項目
+	 * @param origin Boss位置
+	 * @param aimDirection 朝向目標的單位向量（aimAtTarget時使用）
+	 * @param scratch 呼叫端重複使用的暫存，避免每批配置
+	 */
+	void Emit(const BossPatternSkill &skill, const BossPatternEmission &emission, const glm::vec2 &origin,
+			  const glm::vec2 &aimDirection, AttackManager &attackManager, std::vector<AttackShot> &scratch,
+			  const SummonFunc &summon) const;
+
+private:
+	void LoadBullets(const nlohmann::json &bullets);
+	void CompileSkill(const std::string &name, const nlohmann::json &skillJson);
+
+	std::vector<BossBulletTemplate> m_Bullets;
+	std::unordered_map<std::string, uint16_t> m_BulletIndex; // 只在編譯時用
+	std::unordered_map<std::string, BossPatternSkill> m_Skills;
+};
+
+#endif // BOSSPATTERN_HPP
@@ -0,0 +1,68 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef BULLETBATCHDRAWABLE_HPP
+#define BULLETBATCHDRAWABLE_HPP
+
+#include <unordered_map>
+#include "Core/Drawable.hpp"
+#include "Core/Program.hpp"
+#include "Core/Texture.hpp"
+#include "Core/UniformBuffer.hpp"
+
+class BulletSystem;
+class Camera;
+
+/**
+ * @brief BulletSystem的批次繪製
+ *
+ * 每幀在Draw時依鏡頭把所有子彈的四邊形寫進同一個動態頂點緩衝（視窗像素座標），
+ * 相同貼圖的子彈連在一起，每種貼圖只呼叫一次glDrawElements。
+ * 宿主物件的Transform保持單位矩陣、GetSize為{1,1}，所以模型矩陣只剩ZIndex。
+ */
+class BulletBatchDrawable final : public Core::Drawable {
+public:
+	explicit BulletBatchDrawable(const BulletSystem& system);
+	~BulletBatchDrawable() override;
+
+	BulletBatchDrawable(const BulletBatchDrawable&) = delete;
+	BulletBatchDrawable& operator=(const BulletBatchDrawable&) = delete;
+
+	void Draw(const Core::Matrices& data) override;
+	[[nodiscard]] glm::vec2 GetSize() const override { return {1.0f, 1.0f}; }
+
+	// 取得(必要時載入)貼圖在批次中的索引
+	uint16_t GetTextureIndex(const std::string& imagePath);
+	void SetCamera(const std::shared_ptr<Camera>& camera) { m_camera = camera; }
+
+private:
+	static constexpr int UNIFORM_SURFACE_LOCATION = 0;
+	static constexpr size_t FLOATS_PER_QUAD = 16; // 4個頂點 * (x, y, u, v)
+
+	struct BatchTexture
+	{
+		std::unique_ptr<Core::Texture> texture;
+		glm::vec2 size;
+	};
+
+	void InitGLResources();
+
+	const BulletSystem& m_system;
+	std::weak_ptr<Camera> m_camera;
+
+	std::unique_ptr<Core::Program> m_program;
+	std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_uniformBuffer;
+	GLuint m_vertexArray = 0;
+	GLuint m_vertexBuffer = 0;
+	GLuint m_indexBuffer = 0;
+
+	std::vector<BatchTexture> m_textures;
+	std::unordered_map<std::string, uint16_t> m_textureIndices;
+
+	// 每種貼圖一個桶，容量跨幀保留
+	std::vector<std::vector<float>> m_buckets;
+	std::vector<float> m_vertices;
+};
+
+#endif //BULLETBATCHDRAWABLE_HPP
@@ -0,0 +1,106 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef BULLETSYSTEM_HPP
+#define BULLETSYSTEM_HPP
+
+#include <vector>
+#include "Attack/Projectile.hpp"
+
+class BulletBatchDrawable;
+class Camera;
+class RoomCollisionManager;
+namespace Util { class Renderer; }
+
+/**
+ * @brief 一般子彈的SoA模擬
+ *
+ * 只會直線飛行、反彈、被斬擊反彈/阻擋的子彈不建立Projectile物件：屬性拆成連續陣列，
+ * 每幀用一個可向量化的迴圈積分位置，碰撞直接查詢房間碰撞物的快照，最後交給BulletBatchDrawable一次畫完。
+ * 追蹤、泡泡、泡泡尾跡、連鎖攻擊這類有額外行爲的子彈仍然走Projectile。
+ */
+class BulletSystem {
+public:
+	static constexpr size_t MAX_BULLETS = 4096;
+	static constexpr float MAX_TRAVEL_DISTANCE = 530.0f; // 與Projectile相同的射程
+	static constexpr float PROJECTILE_SCALE = 0.7f;		 // 與Projectile相同的縮放
+
+	BulletSystem();
+	~BulletSystem();
+
+	BulletSystem(const BulletSystem&) = delete;
+	BulletSystem& operator=(const BulletSystem&) = delete;
+
+	// 是否可以交給SoA模擬（沒有需要逐顆物件處理的特殊行爲）
+	static bool CanSimulate(const ProjectileInfo& projectileInfo);
+
+	// 生成一顆子彈，滿了返回false（呼叫者改用Projectile）
+	bool Spawn(const ProjectileInfo& projectileInfo);
+	void Update(float deltaTime, const std::shared_ptr<RoomCollisionManager>& collisionManager);
+
+	// 把批次繪製物件掛到場景的渲染樹（換了渲染樹才會重新加入）
+	void AttachRenderer(const std::shared_ptr<Util::Renderer>& root, const std::shared_ptr<Camera>& camera);
+
+	//----Getter----
+	[[nodiscard]] size_t GetCount() const { return m_count; }
+	[[nodiscard]] bool Empty() const { return m_count == 0; }
+
+private:
+	friend class BulletBatchDrawable;
+
+	enum class TargetKind : uint8_t { NONE, CHARACTER, DESTRUCTIBLE };
+	enum class ProjectileResponse : uint8_t { NONE, REFLECT, BLOCK };
+
+	// 每幀從碰撞管理器拍下的碰撞物快照
+	struct ColliderSnapshot
+	{
+		std::shared_ptr<nGameObject> object;
+		float left, right, bottom, top;
+		uint8_t layer, mask;
+		bool isCollider, isTrigger;
+		TargetKind kind;
+		CharacterType characterType;
+		bool hasHealth;
+		ProjectileResponse response; // 玩家斬擊對敵方子彈的處理
+	};
+
+	static void SetupCollisionLayer(CharacterType type, uint8_t& layer, uint8_t& mask);
+	void BuildColliderSnapshot(const std::shared_ptr<RoomCollisionManager>& collisionManager, uint8_t bulletMasks);
+	void ResolveCollisions();
+	void RemoveDeadBullets();
+	void ReflectBySword(size_t index);
+
+	// ---- SoA 子彈資料 ----
+	size_t m_count = 0;
+	std::vector<float> m_posX, m_posY;
+	std::vector<float> m_startX, m_startY;
+	std::vector<float> m_dirX, m_dirY;
+	std::vector<float> m_speed;
+	std::vector<float> m_size;
+	std::vector<float> m_rotation;
+	std::vector<int> m_damage;
+	std::vector<StatusEffect> m_element;
+	std::vector<uint8_t> m_isCriticalHit;
+	std::vector<int> m_reboundLeft;
+	std::vector<uint8_t> m_canReboundBySword;
+	std::vector<CharacterType> m_ownerType;
+	std::vector<uint8_t> m_layer, m_mask;
+	std::vector<uint16_t> m_textureIndex;
+	std::vector<int> m_sourceId; // 傷害來源ID（負數，不會和nGameObject撞號）
+	std::vector<uint8_t> m_dead;
+
+	// ---- 碰撞快照（容量跨幀保留） ----
+	std::vector<ColliderSnapshot> m_colliders;
+	std::vector<std::pair<int64_t, uint32_t>> m_cellEntries; // (格子key, 碰撞物索引) 依key排序
+	std::vector<uint32_t> m_colliderStamp;
+	uint32_t m_stamp = 0;
+
+	static int s_nextSourceId;
+
+	std::shared_ptr<BulletBatchDrawable> m_drawable;
+	std::shared_ptr<nGameObject> m_renderHost;
+	std::weak_ptr<Util::Renderer> m_renderRoot;
+};
+
+#endif //BULLETSYSTEM_HPP
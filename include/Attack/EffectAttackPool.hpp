@@ -5,19 +5,17 @@
 #ifndef EFFECTATTACKPOOL_HPP
 #define EFFECTATTACKPOOL_HPP
 
-#include <deque>
+#include "Attack/AttackPool.hpp"
 #include "Attack/EffectAttack.hpp"
 
-class EffectAttackPool {
+// 每個場景自己的EffectAttack池
+class EffectAttackPool : public AttackPool<EffectAttack, EffectAttackInfo> {
 public:
-	explicit EffectAttackPool();
-	~EffectAttackPool() = default;
-	std::shared_ptr<EffectAttack> Acquire(const EffectAttackInfo &effect_attack_info);
-
-	void Release(const std::shared_ptr<EffectAttack> &effectAttack) { pool.push_back(std::move(effectAttack)); }
+	EffectAttackPool(size_t prewarmCount, size_t growStep);
+	~EffectAttackPool() override = default;
 
 private:
-	static std::deque<std::shared_ptr<EffectAttack>> pool;
+	static EffectAttackInfo MakeWarmupInfo();
 };
 
 #endif //EFFECTATTACKPOOL_HPP
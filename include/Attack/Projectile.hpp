@@ -75,6 +75,9 @@ protected:
 	// 子彈追蹤
 	std::weak_ptr<nGameObject> m_Target;	// 此物件會跟隨目標旋轉
 	float m_bezierTime = 0.0f;				// 貝茲曲線的插值參數：範圍 [0, 0.25]
+	static constexpr float TRACKING_STEER_INTERVAL = 0.05f; // 轉向每秒只重算20次，其間沿原方向直線前進
+	float m_steerTimer = 0.0f;				// 距離下次轉向的時間（0：下一幀立即轉向）
+	float m_steerElapsed = 0.0f;			// 上次轉向後累積的時間，推進貝茲參數用
 
 	// 泡泡間隔時間與計時器
 	float m_bubbleSpawnInterval = 0.2f;  // 每0.2秒生成一次
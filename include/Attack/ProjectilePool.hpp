@@ -5,21 +5,17 @@
 #ifndef PROJECTILEPOOL_HPP
 #define PROJECTILEPOOL_HPP
 
-#include <deque>
+#include "Attack/AttackPool.hpp"
 #include "Attack/Projectile.hpp"
 
-class ProjectilePool {
+// 每個場景自己的Projectile池（一般子彈走BulletSystem，這裏只剩特殊子彈與溢出的子彈）
+class ProjectilePool : public AttackPool<Projectile, ProjectileInfo> {
 public:
-	explicit ProjectilePool();
-	~ProjectilePool() = default;
-	std::shared_ptr<Projectile> Acquire(const ProjectileInfo& projectileInfo);
-
-	void Release(const std::shared_ptr<Projectile>& bullet) {
-		pool.push_back(std::move(bullet));
-	}
+	ProjectilePool(size_t prewarmCount, size_t growStep);
+	~ProjectilePool() override = default;
 
 private:
-	static std::deque<std::shared_ptr<Projectile>> pool; // 更高效的内存管理
+	static ProjectileInfo MakeWarmupInfo();
 };
 
 
@@ -0,0 +1,43 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef TARGETPREDICTOR_HPP
+#define TARGETPREDICTOR_HPP
+
+#include <vector>
+#include "glm/vec2.hpp"
+
+/**
+ * @brief 提前量瞄準：依目標速度與子彈速度算出攔截點
+ *
+ * 解 |r + v·t| = s·t（r：射手到目標、v：目標速度、s：子彈速度）取正根，
+ * 目標比子彈快或解出的時間超過MAX_LEAD_TIME就只瞄準（或最多預判到）該時間內的位置。
+ * 單發用PredictIntercept；一幀內很多射手時用Add累積、Solve一次算完（SoA、無分支，編譯器可向量化）。
+ */
+class TargetPredictor
+{
+public:
+	static constexpr float MAX_LEAD_TIME = 1.0f; // 最多預判幾秒，避免遠距離亂瞄
+
+	[[nodiscard]] static glm::vec2 PredictIntercept(const glm::vec2 &shooter, const glm::vec2 &target,
+													const glm::vec2 &targetVelocity, float projectileSpeed);
+
+	void Clear();
+	// 回傳索引，Solve之後用GetAimPoint取結果
+	size_t Add(const glm::vec2 &shooter, const glm::vec2 &target, const glm::vec2 &targetVelocity,
+			   float projectileSpeed);
+	void Solve();
+
+	[[nodiscard]] glm::vec2 GetAimPoint(const size_t index) const { return {m_AimX[index], m_AimY[index]}; }
+	[[nodiscard]] size_t GetCount() const { return m_Speed.size(); }
+
+private:
+	std::vector<float> m_ShooterX, m_ShooterY;
+	std::vector<float> m_TargetX, m_TargetY;
+	std::vector<float> m_VelocityX, m_VelocityY;
+	std::vector<float> m_Speed;
+	std::vector<float> m_AimX, m_AimY;
+};
+
+#endif // TARGETPREDICTOR_HPP
@@ -10,6 +10,7 @@
 #include "Observer.hpp"
 #include "Util/Timer.hpp"
 #include "Util/Transform.hpp"
+#include "Util/WeakIndexedList.hpp"
 
 // 前向聲明
 class nGameObject;
@@ -58,7 +59,7 @@ protected:
 
 private:
 	std::weak_ptr<nGameObject> m_FollowTarget;
-	std::vector<std::weak_ptr<nGameObject>> m_Children;
+	Util::WeakIndexedList<nGameObject> m_Children; // 索引表讓移除是O(1)
 	std::vector<std::weak_ptr<nGameObject>> m_ToAddList;
 	std::vector<std::weak_ptr<nGameObject>> m_ToRemoveList;
 
@@ -6,13 +6,14 @@
 #define AICOMPONENT_HPP
 
 #include "Component.hpp"
+#include "Components/EnemyAI/BehaviorTree.hpp"
+#include "Components/EnemyAI/MoveStrategy.hpp"
 #include "Observer.hpp"
 
 #include "StructType.hpp"
 #include "Structs/CollisionComponentStruct.hpp"
 
 
-class IMoveStrategy;
 class IAttackStrategy;
 class IUtilityStrategy;
 
@@ -21,12 +22,18 @@ class AIComponent : public Component, public TrackingObserver
 public:
 	explicit AIComponent(MonsterType MonsterType, const std::shared_ptr<IMoveStrategy> &moveStrategy,
 						 const std::unordered_map<AttackStrategies, std::shared_ptr<IAttackStrategy>> &attackStrategies,
-						 const std::shared_ptr<IUtilityStrategy> &utilityStrategies, int monsterPoint);
+						 const std::shared_ptr<IUtilityStrategy> &utilityStrategies, int monsterPoint,
+						 const BehaviorTree *behaviorTree = nullptr);
 	~AIComponent() override = default;
 
 	void Init() override;
+	// 每幀：只做便宜的轉向；沒有排程器接管時才自己思考
 	void Update() override;
+	// 思考：有行為樹就執行共用的行為樹，否則跑移動/攻擊/輔助策略，deltaTime用距離上次思考的實際時間
+	// perception 為排程器平行階段算好的感知結果，只在這次思考期間有效
+	void Think(const AIPerception *perception = nullptr);
 
+	void HandleCollision(const CollisionEventInfo &info) override;
 	void HandleEvent(const EventInfo &eventInfo) override;
 	std::vector<EventType> SubscribedEventTypes() const override;
 
@@ -38,6 +45,10 @@ public:
 	[[nodiscard]] float GetReadyAttackCountdown() const { return m_readyAttackTime; }
 	[[nodiscard]] float GetReadyAttackTimer() const { return m_readyAttackTimer; }
 	[[nodiscard]] float GetSkillTimer() const { return m_skillTimer; }
+	[[nodiscard]] uint32_t GetLastThinkFrame() const { return m_lastThinkFrame; }
+	// 思考期間才有值，其他時候為nullptr
+	[[nodiscard]] const AIPerception *GetPerception() const { return m_perception; }
+	[[nodiscard]] const BehaviorTree *GetBehaviorTree() const { return m_behaviorTree; }
 	[[nodiscard]] std::shared_ptr<IAttackStrategy> GetAttackStrategy(AttackStrategies type) const {
 		auto it = m_attackStrategy.find(type);
 		if (it != m_attackStrategy.end()) {
@@ -55,9 +66,13 @@ public:
 	void DeductionReadyAttackTimer(const float time) { m_readyAttackTimer -= time; }
 	void SetSkillTimer(float duration) { m_skillTimer = duration; }
 	void DeductionSkillTimer(float deltaTime) { m_skillTimer -= deltaTime; }
+	void SetScheduled(const bool scheduled) { m_scheduled = scheduled; }
+	void SetLastThinkFrame(const uint32_t frame) { m_lastThinkFrame = frame; }
 
 	void ShowReadyAttackIcon() const;
 	void HideReadyAttackIcon();
+	// 開槍前套用排程器算好的提前量：把目前武器轉向攔截點
+	void ApplyAimPoint() const;
 
 
 protected:
@@ -71,11 +86,19 @@ protected:
 	const float m_readyAttackTime = 1.5f;
 	float m_readyAttackTimer = 0.0f;
 	float m_skillTimer = 0.0f;  // 技能計時器
+	bool m_scheduled = false; // 由房間的AIScheduler決定何時思考
+	uint32_t m_lastThinkFrame = 0;
+	float m_lastThinkTimeMs = -1.0f;
+	const AIPerception *m_perception = nullptr;
 	glm::vec2 m_iconOffset = glm::vec2(-15.0f, 15.0f);
 	std::shared_ptr<nGameObject> m_readyAttackIcon;
 	std::shared_ptr<IMoveStrategy> m_moveStrategy;
 	std::unordered_map<AttackStrategies, std::shared_ptr<IAttackStrategy>> m_attackStrategy;
 	std::shared_ptr<IUtilityStrategy> m_utilityStrategy;
+	// 行為樹驅動時：樹由同類敵人共用，自己只有黑板與移動狀態
+	const BehaviorTree *m_behaviorTree = nullptr;
+	BTBlackboard m_blackboard;
+	EnemyMotion m_motion;
 };
 
 
@@ -12,6 +12,7 @@
 #include "Util/Logger.hpp"
 
 class nGameObject;
+struct TakeDamageEventInfo;
 
 class Component
 {
@@ -22,7 +23,9 @@ public:
 
 	virtual void Init() {} // nGameObject在AddComponent就會自動執行 -- nGameObject.inl
 	virtual void Update() {} // n
+	// 高頻事件的型別化入口：nGameObject::OnEvent在編譯期已知事件型別時直接呼叫，省去HandleEvent内的dynamic_cast
 	virtual void HandleCollision(const CollisionEventInfo &info) {}
+	virtual void HandleTakeDamage(const TakeDamageEventInfo &info) {}
 
 	// template <typename EventT,typename... Args>
 	virtual void HandleEvent(const EventInfo& eventInfo) { LOG_DEBUG("HandleEvent");}
@@ -22,22 +22,16 @@ public:
 			EventType::Collision
 		};
 	}
-	void HandleEvent(const EventInfo &eventInfo) override
+	void HandleCollision(const CollisionEventInfo &) override
 	{
-		switch (eventInfo.GetEventType())
+		// 碰到地形就停止延伸（衝擊波、光束不會穿牆）
+		const auto owner = GetOwner<EffectAttack>();
+		if (!owner)
 		{
-			case EventType::Collision:
-			{
-				const auto& collisionEventInfo = dynamic_cast<const CollisionEventInfo&>(eventInfo);
-				const auto owner = GetOwner<EffectAttack>();
-				if(!owner) LOG_ERROR("don't have");
-				owner->SetIsCollisionWithTerrain(true);
-				// owner->MarkForRemoval();
-				break;
-			}
-			default:
-				break;
+			LOG_ERROR("EffectAttackComponent: owner is not an EffectAttack");
+			return;
 		}
+		owner->SetIsCollisionWithTerrain(true);
 	}
 };
 
@@ -7,7 +7,10 @@
 
 #include <glm/vec2.hpp>
 #include <unordered_map>
+#include <vector>
 class Character;
+struct AttackShot;
+struct BossPatternSkill;
 struct EnemyContext;
 
 //--------------------------------------------
@@ -87,14 +90,9 @@ public:
         int currentPhase;      // 技能当前阶段（用于多阶段技能）
     };
 
-    BossAttackStrategy() {
-        // 初始化技能信息
-        skills[BossSkillType::SKILL1] = {5.0f, 6.0f, 0.0f, false, 0.0f, 0};  // 雪球投掷：5秒冷却，6秒持续，沒有前摇，共3 輪（2s/1phase）
-        skills[BossSkillType::SKILL2] = {8.0f, 2.66, 0.055f, false, 0.0f, 0};  // 雪花风暴：8秒冷却，2秒持续，0.016秒前摇
-        skills[BossSkillType::SKILL3] = {6.0f, 1.0f, 0.8f, false, 0.0f, 0};  // 火眼：6秒冷却，1秒持续，0.8秒前摇
-        skills[BossSkillType::SKILL4] = {7.0f, 1.29f, 1.0f, false, 0.0f, 0};  // 冰霜荆棘：7秒冷却，1.5秒持续，0.4秒前摇
-        skills[BossSkillType::SKILL5] = {12.0f, 2.9166f, 0.5f, false, 0.0f, 0}; // 雪人召唤：12秒冷却，4秒持续，0.2秒前摇
-    }
+    // 技能的冷卻/持續/前搖與彈幕都來自 json/bossPattern.json（SKILL1..SKILL5）
+    BossAttackStrategy();
+    ~BossAttackStrategy() override;
 
     [[nodiscard]] bool CanAttack(const EnemyContext &ctx) override;
     [[nodiscard]] float GetAttackDistance() const override { return 100.0F; }
@@ -109,20 +107,12 @@ private:
     BossSkillType currentSkill = BossSkillType::SKILL1;
     std::unordered_map<BossSkillType, SkillInfo> skills;
 
+    std::unordered_map<BossSkillType, const BossPatternSkill*> patterns; // 編譯好的發射表，沒有定義的技能爲nullptr
+    std::vector<AttackShot> shotScratch; // 每批子彈重複使用
+
+    // 依經過時間發射到期的項目（currentPhase = 下一個要發射的項目）
     void ExecuteCurrentSkill(const EnemyContext& ctx);
 
-    // Skill
-    void ExecuteSkill1(const EnemyContext& ctx);  // 雪球投掷
-    void ExecuteSkill2(const EnemyContext& ctx);  // 雪花风暴
-    void ExecuteSkill3(const EnemyContext& ctx);  // 火眼
-    void ExecuteSkill4(const EnemyContext& ctx);  // 冰霜荆棘
-    void ExecuteSkill5(const EnemyContext& ctx);  // 雪人召唤
-
-    void SpawnLargeSnowball(const EnemyContext& ctx, const glm::vec2& direction);
-    void SpawnSmallSnowball(const EnemyContext& ctx, const glm::vec2& direction, const glm::vec2& offset);
-    void SpawnLongBullet(const EnemyContext& ctx, const glm::vec2& direction);
-    void SpawnIceSpike(const EnemyContext& ctx, const glm::vec2& direction);
-    void SpawnShockwave(const EnemyContext& ctx);
-    void SpawnMiniSnowman(const EnemyContext& ctx, const glm::vec2& position);
+    void SpawnMinion(const EnemyContext& ctx, int enemyId, const glm::vec2& position);
 };
 #endif //ATTACKSTRATEGY_HPP
\ No newline at end of file
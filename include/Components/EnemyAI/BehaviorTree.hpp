@@ -0,0 +1,117 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#ifndef BEHAVIORTREE_HPP
+#define BEHAVIORTREE_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "EnumTypes.hpp"
+#include "json.hpp"
+
+struct EnemyContext;
+struct EnemyMotion;
+
+// 每個敵人一份的黑板：固定大小、連續記憶體，槽位由樹在載入時配置（計時器、旗標）
+struct BTBlackboard
+{
+	static constexpr size_t MAX_SLOTS = 8;
+	std::array<float, MAX_SLOTS> values{};
+};
+
+enum class BTStatus : uint8_t
+{
+	SUCCESS,
+	FAILURE
+};
+
+enum class BTNodeType : uint8_t
+{
+	// 組合/裝飾
+	SELECTOR, // 依序執行子節點，遇到成功就停
+	SEQUENCE, // 依序執行子節點，遇到失敗就停
+	INVERT,	  // 反轉唯一子節點的結果
+	// 條件
+	IS_STATE,		 // 目前的enemyState
+	HAS_TARGET,		 // 有鎖定目標
+	IN_ATTACK_RANGE, // 目標距離在[min, max)，可要求網格視線
+	IS_FLAG,		 // 黑板槽位非0
+	// 動作
+	COUNTDOWN,	  // 槽位扣掉deltaTime，歸零才成功
+	SET_VALUE,	  // 槽位寫入固定值
+	SET_TIMER,	  // 槽位寫入[min, max]的亂數
+	SET_STATE,	  // 切換enemyState
+	STOP,		  // 停止移動並站立
+	REST,		  // 停下進入閑置，休息時間寫進槽位
+	WANDER,		  // 隨機方向遊蕩，移動時間寫進槽位
+	CHASE,		  // 維持與目標的距離
+	KEEP_RANGE,	  // 槍械敵人保持射程
+	READY_ATTACK, // 顯示預警圖示並進入READY_ATTACK
+	CHARGE,		  // 扣預警計時，歸零才成功
+	ATTACK		  // 出手並回到閑置
+};
+
+// 扁平陣列裏的一個節點（前序排列，子節點緊接在父節點之後）
+struct BTNode
+{
+	BTNodeType type = BTNodeType::SEQUENCE;
+	uint8_t slot = 0;	 // 黑板槽位
+	bool flag = false;	 // CHASE：面向目標；IN_ATTACK_RANGE：需要視線；ATTACK：出手後停下
+	enemyState state = enemyState::IDLE;
+	uint16_t end = 0; // 子樹結束後的索引，也就是下一個兄弟節點
+	float a = 0.0f;	  // 參數（距離/最短時間/速度…依節點而定）
+	float b = 0.0f;
+	float c = 0.0f;
+};
+
+/**
+ * @brief 敵人行為樹：json/enemyBehavior.json 描述，每種行為只編譯一次，
+ * 同行為的所有敵人共用同一棵樹（唯讀），各自只持有一份BTBlackboard。
+ * 節點以前序排在連續陣列裏，執行時依節點型別switch，沒有逐節點的虛擬呼叫。
+ */
+class BehaviorTree
+{
+public:
+	BehaviorTree(const std::string &name, const nlohmann::json &treeJson);
+
+	// 每次思考執行一次
+	void Tick(const EnemyContext &ctx, BTBlackboard &blackboard, EnemyMotion &motion, float deltaTime) const;
+
+	[[nodiscard]] const std::string &GetName() const { return m_Name; }
+	[[nodiscard]] size_t GetNodeCount() const { return m_Nodes.size(); }
+	// 撞到玩家停下時寫入休息時間的槽位（樹沒有"rest"鍵則爲-1）
+	[[nodiscard]] int GetRestSlot() const { return m_RestSlot; }
+
+private:
+	BTStatus Run(uint16_t index, const EnemyContext &ctx, BTBlackboard &blackboard, EnemyMotion &motion,
+				 float deltaTime) const;
+	void Compile(const nlohmann::json &nodeJson);
+	uint8_t Slot(const std::string &key);
+
+	std::string m_Name;
+	std::vector<BTNode> m_Nodes;
+	std::unordered_map<std::string, uint8_t> m_Slots; // 只在編譯時用
+	int m_RestSlot = -1;
+};
+
+// 所有行為樹：整個程式只載入一次，依名稱共用
+class BehaviorTreeLibrary
+{
+public:
+	static const BehaviorTreeLibrary &GetInstance();
+
+	explicit BehaviorTreeLibrary(const nlohmann::json &data);
+
+	// 找不到回傳nullptr（敵人改用原本的策略物件）
+	[[nodiscard]] const BehaviorTree *Find(const std::string &name) const;
+
+private:
+	std::unordered_map<std::string, BehaviorTree> m_Trees;
+};
+
+#endif // BEHAVIORTREE_HPP
@@ -10,12 +10,45 @@
 #include <vector>
 
 #include "EnumTypes.hpp"
+#include "Room/GridPathfinder.hpp"
 
 class IAttackStrategy;
 struct CollisionEventInfo;
 struct EnemyContext;
 class nGameObject;
 
+// 每個敵人的移動狀態：移動策略物件或AIComponent（行為樹驅動）各持有一份
+struct EnemyMotion
+{
+	PathFollower pathFollower; // 被障礙物擋住時沿房間尋路路徑走
+	float steerSpeed = 0.0f;   // 上次思考決定往目標前進的速度，0表示逐幀不修正
+};
+
+//--------------------------------------------
+// 移動邏輯（移動策略與行為樹共用）
+//--------------------------------------------
+namespace EnemyMovement
+{
+	// 兩次思考之間每幀呼叫：上次決定往目標前進時，依目標目前位置修正方向（流場取樣，O(1)）
+	void Steer(const EnemyContext &ctx, EnemyMotion &motion);
+	// 碰撞反應；撞到玩家而停下時把休息時間寫進restTimer
+	void CollisionAction(const CollisionEventInfo &info, const EnemyContext &ctx, EnemyMotion &motion,
+						 float &restTimer);
+	void ReflectMovement(const CollisionEventInfo &info, const EnemyContext &ctx);
+	// 進入遊蕩並回傳移動持續時間
+	float EnterWanderState(const EnemyContext &ctx, float minTime, float maxTime, float moveRatio = 0.2f);
+	// 停下進入閑置並回傳休息時間
+	float ChangeToIdle(const EnemyContext &ctx, float minTime, float maxTime);
+	// 往targetPos的單位方向：先取樣房間流場，取不到再逐一尋路
+	glm::vec2 DirectionToward(const EnemyContext &ctx, EnemyMotion &motion, const glm::vec2 &targetPos);
+
+	void MaintainDistanceMove(const EnemyContext &ctx, EnemyMotion &motion, float optimalDistance, float speed,
+							  bool faceToTarget);
+	void MaintainCircleMove(const EnemyContext &ctx, EnemyMotion &motion, float circleRadius, float speed);
+	// 槍械敵人保持在attackDistance的八成左右
+	void MaintainRangeForGun(const EnemyContext &ctx, EnemyMotion &motion, float attackDistance);
+} // namespace EnemyMovement
+
 //--------------------------------------------
 // Strategy Interfaces
 //--------------------------------------------
@@ -24,22 +57,25 @@ class IMoveStrategy
 public:
 	virtual ~IMoveStrategy() = default;
 	virtual void Update(const EnemyContext &ctx, float deltaTime) = 0;
-	void CollisionAction(const CollisionEventInfo &info, const EnemyContext &ctx);
+	void Steer(const EnemyContext &ctx) { EnemyMovement::Steer(ctx, m_motion); }
+	void ResetSteering() { m_motion.steerSpeed = 0.0f; } // 每次思考前清掉，由這次的決定重新設定
+	void CollisionAction(const CollisionEventInfo &info, const EnemyContext &ctx)
+	{
+		EnemyMovement::CollisionAction(info, ctx, m_motion, m_restTimer);
+	}
 
 protected:
 	bool m_mandatoryRest = false; // 强制休息
 	float m_restTimer = 0.0f; // 休息時間計時器
 	float m_moveTimer = 0; // 移動時間計時器
 	float m_detectionRange = 150.0f;
+	EnemyMotion m_motion;
 
 	void changeToIdle(const EnemyContext &ctx, float minTime, float maxTime);
-	void ReflectMovement(const CollisionEventInfo &info, const EnemyContext &ctx);
 	void EnterWanderState(const EnemyContext &ctx, float minTime, float maxTime, float moveRatio = 0.2f);
 	void RestIfNeeded(float deltaTime, const EnemyContext &ctx, float minTime, float maxTime);
 
 	// 移動邏輯
-	void MaintainDistanceMove(const EnemyContext& ctx, float optimalDistance, float speed, bool faceToTarget);
-	void MaintainCircleMove(const EnemyContext& ctx, float circleRadius, float speed);
 	void MaintainStrafeMove(const EnemyContext& ctx, float optimalDistance, float deltaTime, float speed);
 };
 
@@ -56,7 +92,7 @@ class ChaseMove final : public IMoveStrategy
 {
 public:
 	void Update(const EnemyContext &ctx, float deltaTime) override;
-	void MaintainOptimalRangeForGun(const EnemyContext &ctx, std::shared_ptr<nGameObject> target, const std::shared_ptr<IAttackStrategy>& gunStrategy) const;
+	void MaintainOptimalRangeForGun(const EnemyContext &ctx, std::shared_ptr<nGameObject> target, const std::shared_ptr<IAttackStrategy>& gunStrategy);
 	void checkAttackCondition(const EnemyContext &ctx) const;
 
 private:
@@ -28,6 +28,8 @@ public:
 	~FollowerComponent() override = default;
 
 	void BaseTargetRotate();
+	// 立即把武器轉向指定的世界座標（敵人開槍前套用預判瞄準點）
+	void AimAt(const glm::vec2 &worldPoint);
 	void Update() override;
 
 
@@ -65,6 +65,7 @@ public:
 
 	void TakeDamage(int damage);
 	void HandleCollision(const CollisionEventInfo &info) override;
+	void HandleTakeDamage(const TakeDamageEventInfo &dmgInfo) override;
 	void HandleEvent(const EventInfo &eventInfo) override;
 	std::vector<EventType> SubscribedEventTypes() const override;
 
@@ -44,6 +44,8 @@ public:
 	void SetOnIce(bool isOnIce) { m_IsOnIce = isOnIce; }
 	// 控制移動
 	void SetDesiredDirection(const glm::vec2 &direction) { m_DesiredDirection = direction; }
+	// 群體分離修正（AIScheduler每幀寫入），積分前與期望方向合成
+	void SetSeparation(const glm::vec2 &separation) { m_Separation = separation; }
 
 private:
 	bool m_freeze = false;
@@ -53,6 +55,7 @@ private:
 	bool m_IsOnIce = false; // 是否在冰面
 	glm::vec2 m_Position; // 當前位置
 	glm::vec2 m_DesiredDirection; // 移動方向向量（輸入）
+	glm::vec2 m_Separation = glm::vec2(0.0f); // 群體分離修正
 	glm::vec2 m_Velocity; // 當前速度向量
 	glm::vec2 m_ImpulseVelocity = glm::vec2(0.0f);  // 外部施加的推力
 	float m_ImpulseDamping = 6.0f;						// 衰減速度
@@ -0,0 +1,55 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef CONTENTHOTRELOAD_HPP
+#define CONTENTHOTRELOAD_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Util
+{
+	class FileWatcher;
+}
+
+/**
+ * @brief json/ 的熱重載
+ *
+ * 背景監看 JSON_DIR，主執行緒每幀Poll：改過的檔案先確認是合法json（存到一半或打錯字就保留舊資料），
+ * 再讓內容包改讀文字檔、清掉相關快取（佈局預製件、物件定義表、敵人原型），最後通知訂閱者，
+ * 由場景決定要不要原地重建目前的房間。
+ * 只有用 -DCONTENT_HOT_RELOAD=ON 建置時Start才會開始監看，否則整個服務什麼都不做。
+ */
+class ContentHotReload
+{
+public:
+	using Listener = std::function<void(const std::string &relativePath)>; // 相對json/，例如 "enemy.json"
+	using ListenerID = size_t;
+
+	static ContentHotReload &GetInstance();
+
+	void Start(); // 沒開CONTENT_HOT_RELOAD或已經在監看就不做事
+	void Stop();
+	void Poll();
+
+	ListenerID Subscribe(Listener listener);
+	void Unsubscribe(ListenerID listenerID);
+
+private:
+	ContentHotReload();
+	~ContentHotReload();
+	ContentHotReload(const ContentHotReload &) = delete;
+	ContentHotReload &operator=(const ContentHotReload &) = delete;
+
+	static void InvalidateCaches(const std::string &relativePath);
+
+	std::unique_ptr<Util::FileWatcher> m_Watcher;
+	std::vector<std::pair<ListenerID, Listener>> m_Listeners;
+	ListenerID m_NextListenerID = 1;
+};
+
+#endif // CONTENTHOTRELOAD_HPP
@@ -142,7 +142,8 @@ enum class ManagerTypes
 	ROOMINTERACTIONMANAGER,
 	INPUT,
 	SCENE,
-	TRACKING
+	TRACKING,
+	AISCHEDULER
 };
 
 enum ZIndexType : int
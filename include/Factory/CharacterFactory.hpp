@@ -5,9 +5,48 @@
 #ifndef CHARACTERFACTORY_HPP
 #define CHARACTERFACTORY_HPP
 
-// #include "EnumTypes.hpp"
+#include <unordered_map>
+#include "EnumTypes.hpp"
 #include "Factory/Factory.hpp"
+#include "glm/vec2.hpp"
 class Character;
+class BehaviorTree;
+namespace Util
+{
+	class Image;
+}
+
+// 預解析的動畫片段：幀圖在第一次生成時才載入，之後同種敵人共用同一組Util::Image
+struct AnimationClip
+{
+	State state = State::STANDING;
+	std::vector<std::string> paths; // 已加上RESOURCE_DIR
+	float interval = 100.0f;
+	bool loop = false;
+	std::vector<std::shared_ptr<Util::Image>> frames;
+};
+
+// 敵人原型：enemy.json 每個ID只解析一次，之後生成只照表組裝元件，不再碰json
+struct EnemyArchetype
+{
+	std::string name;
+	CharacterType type = CharacterType::ENEMY;
+	bool isElite = false;
+	MonsterType aiType = MonsterType::WANDER;
+	int monsterPoint = 0;
+	int maxHp = 0;
+	float moveSpeed = 0.0f;
+	int weaponId = -1; // -1：沒有武器
+	int collisionDamage = 0;
+	const BehaviorTree *behaviorTree = nullptr;
+	std::vector<AttackStrategies> attackStrategies; // 沒有行爲樹時才用
+	std::vector<AnimationClip> clips;
+	bool framesLoaded = false;
+	// 碰撞箱樣板
+	glm::vec2 colliderSize = glm::vec2(16.0f);
+	glm::vec2 colliderOffset = glm::vec2(0.0f, -6.0f);
+	uint8_t collisionMask = 0;
+};
 
 // 角色工廠：根據名稱創建角色
 class CharacterFactory final : public Factory {
@@ -22,12 +61,21 @@ public:
 	std::shared_ptr<Character> createEnemy(const int id);
 	std::shared_ptr<Character> CloneEnemy(const std::shared_ptr<Character>& original);
 	std::shared_ptr<Character> createNPC(const int id);
+	// 敵人碰撞箱大小（生成位置規劃用），不必爲了讀尺寸先建出整隻怪物
+	glm::vec2 GetEnemyCollisionSize(int id);
 	void ClearCache();  // 缓存清理功能
+	void ReloadJson();  // 熱重載：重讀enemy.json / npc.json並清掉原型
 
 private:
 	static CharacterFactory* instance;
 	nlohmann::json enemyJsonData;  // 缓存JSON数据（只需读取一次文件）
 	nlohmann::json npcJsonData;
+	std::unordered_map<int, EnemyArchetype> m_EnemyArchetypes;
+
+	// 找不到ID回傳nullptr；第一次查詢時解析並快取
+	EnemyArchetype* FindEnemyArchetype(int id);
+	static EnemyArchetype ParseEnemyArchetype(const nlohmann::json& characterInfo);
+	std::shared_ptr<Character> InstantiateEnemy(EnemyArchetype& archetype);
 
 	// 预加载JSON
 	CharacterFactory()
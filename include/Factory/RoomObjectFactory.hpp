@@ -5,8 +5,11 @@
 #ifndef ROOMOBJECTFACTORY_HPP
 #define ROOMOBJECTFACTORY_HPP
 
+#include <mutex>
+#include <unordered_map>
 #include "EnumTypes.hpp"
 #include "Factory.hpp"
+#include "Structs/ObjectDataStruct.hpp"
 #include "glm/glm.hpp"
 
 
@@ -24,9 +27,12 @@ enum class ChestType;
 class RoomObjectFactory : public Factory
 {
 public:
-	explicit RoomObjectFactory(const std::shared_ptr<Loader> &loader) : m_Loader(loader) {}
+	explicit RoomObjectFactory(const std::shared_ptr<Loader> &loader);
 	~RoomObjectFactory() override = default;
 
+	// 取得解析好的物件定義（找不到回傳nullptr）
+	[[nodiscard]] const StructObjectData *GetObjectData(const std::string &_id) const;
+
 	// 根據配置文件創建物件
 	std::shared_ptr<nGameObject> CreateRoomObject(const std::string &_id, const std::string &_class = "");
 
@@ -52,12 +58,32 @@ public:
 	std::vector<std::shared_ptr<nGameObject>> CreateDropItems(const std::string &itemType, int quantity,
 															  float scale = 1.0f);
 
+	// 熱重載：丟掉某主題的物件定義表，下次建工廠或ReloadObjectData時重讀
+	static void InvalidateObjectDataTable(const std::string &theme);
+	// 重新取得（可能已重讀的）物件定義表
+	void ReloadObjectData();
+
 	[[nodiscard]] std::string GetObjectDataFilePath() const { return m_ObjectDataFilePath; }
 	void SetObjectDataFilePath(const std::string &prePath) { m_ObjectDataFilePath = prePath + "ObjectData/"; }
 
 	// TODO:測試std::string m_ObjectDataFilePath; /// @param:"Scene(Theme)/ObjectData/"作爲_id的前綴
 	std::string m_ObjectDataFilePath = JSON_DIR "/Lobby/ObjectData"; /// @param:"Scene(Theme)/ObjectData/"作爲_id的前綴
 	std::weak_ptr<Loader> m_Loader;
+
+private:
+	using ObjectDataTable = std::unordered_map<std::string, StructObjectData>;
+	struct ObjectDataRegistry
+	{
+		std::mutex mutex;
+		std::unordered_map<std::string, std::shared_ptr<const ObjectDataTable>> tables; // key: theme
+	};
+	static ObjectDataRegistry &GetObjectDataRegistry();
+
+	// 同主題的所有工廠共用一份表：第一次用到主題時整個ObjectData目錄讀一次，之後唯讀
+	static std::shared_ptr<const ObjectDataTable> AcquireObjectDataTable(Loader &loader);
+	static StructObjectData ParseObjectData(const nlohmann::json &jsonData);
+
+	std::shared_ptr<const ObjectDataTable> m_ObjectData;
 };
 
 #endif // ROOMOBJECTFACTORY_HPP
@@ -6,9 +6,11 @@
 #define LOADER_HPP
 
 #include <json.hpp>
+#include <memory>
 
 // 前向聲明
 class RoomLayoutManager;
+struct RoomPrefab;
 
 class Loader
 {
@@ -16,37 +18,40 @@ public:
 	explicit Loader(std::string theme);
 	~Loader() = default;
 
-	nlohmann::ordered_json LoadLobbyObjectPosition() { return readJsonFile(JSON_DIR "/Lobby/ObjectPosition.json"); };
-	nlohmann::ordered_json LoadStartingRoomObjectPosition()
+	// 房間佈局都經過 RoomPrefabCache，同一份佈局只解析一次
+	std::shared_ptr<const RoomPrefab> LoadLobbyObjectPosition() { return LoadRoomPrefab(JSON_DIR "/Lobby/ObjectPosition.json"); };
+	std::shared_ptr<const RoomPrefab> LoadStartingRoomObjectPosition()
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/StartingRoom/ObjectPosition.json");
+		return LoadRoomPrefab(JSON_DIR "/" + m_Theme + "/StartingRoom/ObjectPosition.json");
 	}
-	nlohmann::ordered_json LoadPortalRoomObjectPosition()
+	std::shared_ptr<const RoomPrefab> LoadPortalRoomObjectPosition()
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/PortalRoom/ObjectPosition.json");
+		return LoadRoomPrefab(JSON_DIR "/" + m_Theme + "/PortalRoom/ObjectPosition.json");
 	}
-	nlohmann::ordered_json LoadSpecialRoomObjectPosition()
+	std::shared_ptr<const RoomPrefab> LoadSpecialRoomObjectPosition()
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/SpecialRoom/ObjectPosition.json");
+		return LoadRoomPrefab(JSON_DIR "/" + m_Theme + "/SpecialRoom/ObjectPosition.json");
 	}
-	nlohmann::ordered_json LoadShopRoomObjectPosition()
+	std::shared_ptr<const RoomPrefab> LoadShopRoomObjectPosition()
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/SpecialRoom/ShopObjectPosition.json");
+		return LoadRoomPrefab(JSON_DIR "/" + m_Theme + "/SpecialRoom/ShopObjectPosition.json");
 	}
-	nlohmann::ordered_json LoadBossRoomObjectPosition()
+	std::shared_ptr<const RoomPrefab> LoadBossRoomObjectPosition()
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/BossRoom/BossObjectPosition_1.json");
+		return LoadRoomPrefab(JSON_DIR "/" + m_Theme + "/BossRoom/BossObjectPosition_1.json");
 	}
 
 	// 原有的固定方法（向後兼容）
-	nlohmann::ordered_json LoadMonsterRoomObjectPosition()
+	std::shared_ptr<const RoomPrefab> LoadMonsterRoomObjectPosition()
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/MonsterRoom/2717ObjectPosition_1.json");
+		return LoadRoomPrefab(JSON_DIR "/" + m_Theme + "/MonsterRoom/2717ObjectPosition_1.json");
 	}
 
 	// 新的隨機和指定佈局方法
-	nlohmann::ordered_json LoadMonsterRoomObjectPosition_Random();
-	nlohmann::ordered_json LoadMonsterRoomObjectPosition_Specific(const std::string &layoutName);
+	std::shared_ptr<const RoomPrefab> LoadMonsterRoomObjectPosition_Random();
+	std::shared_ptr<const RoomPrefab> LoadMonsterRoomObjectPosition_Specific(const std::string &layoutName);
+
+	std::shared_ptr<const RoomPrefab> LoadRoomPrefab(const std::string &layoutPath);
 
 	// 測試用：取得所有可用佈局
 	std::vector<std::string> GetAllMonsterRoomLayouts() const;
@@ -54,8 +59,10 @@ public:
 	// 因爲Dungeon的Theme不同所以要變數
 	nlohmann::ordered_json LoadObjectData(const std::string &ID)
 	{
-		return readJsonFile(JSON_DIR "/" + m_Theme + "/ObjectData/" + ID + ".json");
+		return readJsonFile(GetObjectDataDirectory() + ID + ".json");
 	}
+	[[nodiscard]] std::string GetObjectDataDirectory() const { return JSON_DIR "/" + m_Theme + "/ObjectData/"; }
+	[[nodiscard]] const std::string &GetTheme() const { return m_Theme; }
 
 	nlohmann::ordered_json readJsonFile(const std::string &filePath);
 
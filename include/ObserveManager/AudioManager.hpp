@@ -5,9 +5,12 @@
 #ifndef AUDIOMANAGER_HPP
 #define AUDIOMANAGER_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 
 namespace Util
@@ -16,14 +19,30 @@ namespace Util
 	class BGM;
 } // namespace Util
 
+// 音效代號：名稱第一次查詢時配一個，之後Reset/重新讀設定檔都不變，可以放在static變數裏重複使用
+using SFXHandle = int;
+constexpr SFXHandle INVALID_SFX_HANDLE = -1;
+
+/**
+ * @brief 音效與背景音樂管理
+ *
+ * 每個場景（地城依主題）在設定檔的 "sfx_sets" 列出自己的音效組，進場景時一次解碼，換場景時放掉上一組；
+ * 不在音效組裏的音效第一次播放才解碼，已解碼的總量超過預算時淘汰最久沒播的（音效組裏的最後才淘汰）；
+ * 背景音樂由SDL_mixer邊播邊解碼，同時只開著目前那一首。
+ * 每個音效有同時發聲上限，連發時搶掉自己最舊的那一聲，不會把混音聲道全佔滿。
+ */
 // TODO:如果音量引發性能問題RefreshAllVolum還可以優化
 class AudioManager
 {
 public:
 	static AudioManager &GetInstance();
 
+	// 音效代號（高頻播放的地方先查好代號，省掉每次的字串雜湊）
+	SFXHandle GetSFXHandle(const std::string &name);
+
 	// 播放
 	void PlaySFX(const std::string &name); // e.g., "enemy_die"
+	void PlaySFX(SFXHandle handle);
 	// void PlayBGM(bool loop = true);
 	void PlayBGM(const std::string &name, bool loop = true); // 播放指定BGM
 	void FadeInSFX(const std::string &name, unsigned int tick, int loop = -1, unsigned int duration = -1);
@@ -40,22 +59,55 @@ public:
 	float GetSFXVolume() const { return m_SFXVolume; }
 	float GetBGMVolume() const { return m_BGMVolume; }
 
-	void RegisterSFX(const std::string &name, const std::string &path);
+	void RegisterSFX(const std::string &name, const std::string &path, int maxVoices = DEFAULT_MAX_VOICES);
 	void RegisterBGM(const std::string &path);
 	void RegisterBGM(const std::string &name, const std::string &path); // 註冊命名BGM
 
-	void LoadFromJson(const std::string &path);
+	// sfxSet：這個場景在 "sfx_sets" 裏的音效組名稱，空字串就全部等到播放才解碼
+	void LoadFromJson(const std::string &path, const std::string &sfxSet = "");
 	void Reset(); // 清空SFX和BGM
 
 	void Mute(bool mute);
 
 	void DrawDebugUI();
 
+	static constexpr int DEFAULT_MAX_VOICES = 4; // 同一個音效預設最多同時4聲
+	static constexpr int MIXER_CHANNELS = 32; // SDL_mixer預設只有8個聲道
+	static constexpr size_t SFX_MEMORY_BUDGET = 32 * 1024 * 1024; // 已解碼音效的上限（bytes）
+
 private:
+	struct SFXEntry
+	{
+		std::string name;
+		std::string path;
+		bool registered = false; // 目前的設定檔有沒有這個音效
+		bool inSceneSet = false; // 目前場景的音效組（進場景就解碼）
+		std::shared_ptr<Util::SFX> sfx; // 音效組進場景時載入，其他的第一次播放才載入
+		size_t bytes = 0; // 解碼後大小（以檔案大小估計）
+		int maxVoices = DEFAULT_MAX_VOICES;
+		uint64_t lastPlayed = 0; // 播放序號，淘汰時挑最小的
+		std::vector<int> channels; // 可能還在播的聲道，依播放順序
+	};
+
 	void RefreshAllVolumes();
-	std::unordered_map<std::string, std::shared_ptr<Util::SFX>> m_SFXs;
+	SFXEntry *AcquireSFX(SFXHandle handle); // 需要時載入，找不到回傳nullptr
+	void ReserveVoice(SFXHandle handle, SFXEntry &entry); // 到達發聲上限時停掉最舊的一聲
+	void TrackVoice(SFXHandle handle, SFXEntry &entry, int channel);
+	bool IsPlaying(SFXHandle handle, const SFXEntry &entry) const;
+	void LoadSFX(SFXEntry &entry);
+	void UnloadSFX(SFXEntry &entry);
+	void EvictSFX(SFXHandle keep); // 超過預算時淘汰最久沒播、目前沒在播的音效（先挑音效組以外的）
+	void ReleaseBGM();
+
+	std::vector<SFXEntry> m_SFXEntries; // 以SFXHandle爲索引
+	std::unordered_map<std::string, SFXHandle> m_SFXHandles;
+	std::vector<SFXHandle> m_ChannelOwner; // 每個聲道最後播的音效
+	size_t m_LoadedSFXBytes = 0;
+	uint64_t m_PlayCounter = 0;
+
 	std::shared_ptr<Util::BGM> m_BGM;
-	std::unordered_map<std::string, std::shared_ptr<Util::BGM>> m_BGMs; // 多個BGM支援
+	std::string m_BGMPath; // m_BGM開的檔案
+	std::unordered_map<std::string, std::string> m_BGMPaths; // 多個BGM支援（名稱 -> 路徑，播放時才開檔）
 
 	// 0%~100%
 	float m_MasterVolume = 0.3f;
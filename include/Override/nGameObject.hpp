@@ -7,6 +7,7 @@
 #ifndef NGAMEOBJECT_HPP
 #define NGAMEOBJECT_HPP
 
+#include <array>
 #include "Components/Component.hpp"
 #include "Util/GameObject.hpp"
 
@@ -80,6 +81,10 @@ public:
 
 	[[nodiscard]] bool IsInsideWindow() const { return m_IsInsideWindow; }
 	[[nodiscard]] bool IsControlVisible() const { return m_IsControlVisible; }
+	[[nodiscard]] bool HasEventSubscriber(const EventType type) const
+	{
+		return (m_EventSubscriberMask & EventBit(type)) != 0;
+	}
 
 protected:
 	int m_Id;
@@ -96,11 +101,16 @@ protected:
 	bool m_InitialScaleSet = false; // 標記是否已設置初始縮放
 
 	std::unordered_map<ComponentType, std::shared_ptr<Component>> m_Components;
-	std::unordered_map<EventType, std::vector<Component *>> m_EventSubscribers;
+	// 事件訂閲表：以EventType為索引的平坦陣列，配合bitmask在沒有訂閲者時直接跳過
+	std::array<std::vector<Component *>, EventTypeCount> m_EventSubscribers;
+	uint32_t m_EventSubscriberMask = 0;
 
 	bool m_RegisteredToScene = false;
 
 private:
+	static_assert(EventTypeCount <= 32, "EventType數量超過訂閲bitmask的位數");
+	static constexpr uint32_t EventBit(const EventType type) { return 1u << static_cast<uint32_t>(type); }
+
 	static std::string GenerateUniqueName(const std::string &baseName);
 	static int GenerateUniqueID();
 };
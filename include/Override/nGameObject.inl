@@ -24,7 +24,8 @@ std::shared_ptr<T> nGameObject::AddComponent(ComponentType type, Args &&...args)
 	// 讓Component註冊感興趣的事件型別
 	for (const auto &eventType : component->SubscribedEventTypes())
 	{
-		m_EventSubscribers[eventType].push_back(component.get());
+		m_EventSubscribers[static_cast<size_t>(eventType)].push_back(component.get());
+		m_EventSubscriberMask |= EventBit(eventType);
 	}
 	return component;
 }
@@ -65,8 +66,10 @@ bool nGameObject::RemoveComponent(const ComponentType type)
 		// 從事件訂閱中移除該組件
 		for (const auto &eventType : casted->SubscribedEventTypes())
 		{
-			auto &subscribers = m_EventSubscribers[eventType];
+			auto &subscribers = m_EventSubscribers[static_cast<size_t>(eventType)];
 			subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), casted.get()), subscribers.end());
+			if (subscribers.empty())
+				m_EventSubscriberMask &= ~EventBit(eventType);
 		}
 
 		// 清理組件資源（如果有cleanup方法的話）
@@ -91,12 +94,18 @@ void nGameObject::OnEvent(const EventT &eventInfo)
 	OnEventReceived(eventInfo);
 
 	const EventType eventType = eventInfo.GetEventType();
-	if (const auto it = m_EventSubscribers.find(eventType); it != m_EventSubscribers.end())
+	if (!HasEventSubscriber(eventType))
+		return;
+
+	// 碰撞和傷害是每幀最頻繁的事件：型別已知時直接走型別化的處理函數，不再經過HandleEvent轉型
+	for (auto *component : m_EventSubscribers[static_cast<size_t>(eventType)])
 	{
-		for (auto *component : it->second)
-		{
+		if constexpr (std::is_same_v<EventT, CollisionEventInfo>)
+			component->HandleCollision(eventInfo);
+		else if constexpr (std::is_same_v<EventT, TakeDamageEventInfo>)
+			component->HandleTakeDamage(eventInfo);
+		else
 			component->HandleEvent(eventInfo);
-		}
 	}
 }
 
@@ -0,0 +1,109 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef AISCHEDULER_HPP
+#define AISCHEDULER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Attack/TargetPredictor.hpp"
+#include "ObserveManager/IManager.hpp"
+#include "Room/CrowdSeparation.hpp"
+#include "StructType.hpp"
+#include "Util/WeakIndexedList.hpp"
+#include "glm/vec2.hpp"
+
+class AIComponent;
+class Character;
+class GridFlowField;
+class GridPathfinder;
+class MovementComponent;
+
+// 排程器的每幀統計（調試介面用）
+struct AISchedulerStats
+{
+	size_t registered = 0;	  // 已註冊的敵人
+	size_t thinkCount = 0;	  // 本幀實際思考的數量
+	size_t dueSkipped = 0;	  // 到期但超出預算、延到下一幀的數量
+	size_t inactive = 0;	  // 未激活（隱藏波次）跳過的數量
+	float elapsedMicros = 0;  // 本幀思考花費
+	size_t crowdAgents = 0;	  // 參與群體分離的敵人
+	size_t crowdAdjusted = 0; // 方向被分離修正的敵人
+};
+
+/**
+ * @brief 房間的敵人AI排程器
+ *
+ * 敵人的「思考」（移動/攻擊/輔助策略）不再每幀全跑，而是由排程器依距離與是否在畫面內決定頻率，
+ * 在固定的微秒預算內輪流執行；超出預算的留到下一幀從同一位置接著跑，保證公平。
+ * 未激活（CombatManager::HideAllEnemies 隱藏的波次）的敵人完全不思考。
+ * 便宜的逐幀轉向仍由 AIComponent::Update 對每個敵人執行。
+ * 由Room持有並在Room::Update更新，只有目前房間的敵人會思考。
+ *
+ * 每幀分兩階段：先在主執行緒挑出要思考的敵人並抄下位置/目標（唯讀快照），
+ * 第一階段在執行緒池上平行算感知（距離、網格視線、流場方向），只讀快照與房間導航資料；
+ * 第二階段回到主執行緒依序執行狀態機，寫回元件與送出生成請求。
+ * 拿槍的敵人在快照時一併登記到TargetPredictor，平行階段前整批算好提前量瞄準點。
+ * 最後對所有激活的敵人做群體分離（CrowdSeparation），結果寫進各自的MovementComponent。
+ */
+class AIScheduler : public IManager
+{
+public:
+	static constexpr float THINK_BUDGET_MICROS = 1000.0f;
+	static constexpr size_t MIN_THINKS_PER_FRAME = 4; // 預算再緊也要有進度
+	static constexpr size_t PARALLEL_GRAIN = 8;		  // 每塊平行工作的敵人數，不到一塊就不開執行緒
+	static constexpr size_t CROWD_PARALLEL_GRAIN = 32; // 分離計算很便宜，塊要大一點才值得分出去
+
+	void Update() override;
+
+	void Register(const std::shared_ptr<Character> &enemy);
+	void Unregister(const std::shared_ptr<Character> &enemy);
+	void SetPlayer(const std::shared_ptr<Character> &player) { m_Player = player; }
+	// 由DungeonRoom提供（其他房間沒有網格，感知只算距離）
+	void SetNavigation(const GridPathfinder *pathfinder, const GridFlowField *flowField)
+	{
+		m_Pathfinder = pathfinder;
+		m_FlowField = flowField;
+	}
+
+	[[nodiscard]] const AISchedulerStats &GetStats() const { return m_Stats; }
+
+private:
+	struct ThinkRequest
+	{
+		std::shared_ptr<AIComponent> aiComp;
+		glm::vec2 position = glm::vec2(0.0f);
+		glm::vec2 targetPos = glm::vec2(0.0f);
+		bool hasTarget = false;
+		int aimSlot = -1; // m_Predictor的索引，-1表示不需要預判
+	};
+
+	// 第一階段：在工作執行緒上執行，只能讀request與導航資料
+	void Perceive(const ThinkRequest &request, AIPerception &perception) const;
+
+	// 每幀對所有激活的敵人算分離修正
+	void UpdateSeparation();
+
+	// 依距離/可見度決定幾幀思考一次
+	[[nodiscard]] uint32_t ThinkInterval(const glm::vec2 &enemyPos, const glm::vec2 &playerPos,
+										 const glm::vec2 &viewCenter, const glm::vec2 &viewHalfExtent) const;
+
+	Util::WeakIndexedList<Character> m_Enemies;
+	std::weak_ptr<Character> m_Player;
+	const GridPathfinder *m_Pathfinder = nullptr;
+	const GridFlowField *m_FlowField = nullptr;
+	std::vector<ThinkRequest> m_Batch;		  // 每幀重複使用
+	std::vector<AIPerception> m_Perceptions; // 與m_Batch平行
+	TargetPredictor m_Predictor;
+	float m_AvgThinkMicros = 20.0f;			  // 單次思考成本的移動平均
+	CrowdSeparation m_Crowd;
+	std::vector<std::shared_ptr<MovementComponent>> m_CrowdMovers; // 與m_Crowd的索引對應
+	std::vector<glm::vec2> m_CrowdPush;
+	size_t m_Cursor = 0; // 輪詢起點
+	uint32_t m_Frame = 0;
+	AISchedulerStats m_Stats;
+};
+
+#endif // AISCHEDULER_HPP
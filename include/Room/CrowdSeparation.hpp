@@ -0,0 +1,61 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef CROWDSEPARATION_HPP
+#define CROWDSEPARATION_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "glm/vec2.hpp"
+
+/**
+ * @brief 敵人群體的分離/避讓轉向（RVO簡化版）
+ *
+ * 每幀把房間內活著的敵人（位置、速度、半徑）放進只含敵人的空間雜湊，
+ * 對每個敵人查鄰近3x3格：
+ * - 分離：與鄰居重疊或太近時往反方向推，越近越強
+ * - 避讓：以相對速度預測短時間內的最近距離，會撞上就提早往側邊讓開
+ * 結果交給 MovementComponent::SetSeparation，在積分前與期望方向合成。
+ * Compute 只讀建好的資料，可以平行呼叫。
+ */
+class CrowdSeparation
+{
+public:
+	static constexpr float CELL_SIZE = 48.0f;	   // 大於最大敵人直徑，鄰居一定在3x3格內
+	static constexpr float PERSONAL_SPACE = 1.25f; // 分離半徑 = 兩者半徑和 × 此倍率
+	static constexpr float AVOID_HORIZON = 0.5f;   // 避讓預測的秒數
+	static constexpr float MAX_STRENGTH = 1.5f;	   // 與單位長度的期望方向合成，最多可讓敵人稍微後退
+	static constexpr int BUCKET_COUNT = 256;	   // 2的次方
+
+	struct Agent
+	{
+		glm::vec2 position;
+		glm::vec2 velocity;
+		float radius;
+		int32_t cellX;
+		int32_t cellY;
+	};
+
+	void Clear() { m_Agents.clear(); }
+	// 回傳索引，Compute用
+	size_t AddAgent(const glm::vec2 &position, const glm::vec2 &velocity, float radius);
+	// 加完所有敵人後呼叫：依格子分桶（計數排序，不配置記憶體）
+	void Build();
+
+	// 第index個敵人的修正向量，沒有鄰居時為0
+	[[nodiscard]] glm::vec2 Compute(size_t index) const;
+
+	[[nodiscard]] size_t GetAgentCount() const { return m_Agents.size(); }
+
+private:
+	[[nodiscard]] static int32_t CellCoord(float value);
+	[[nodiscard]] static int Bucket(int32_t cellX, int32_t cellY);
+
+	std::vector<Agent> m_Agents;
+	std::vector<uint32_t> m_Sorted;					  // 依桶排序的敵人索引
+	std::array<uint32_t, BUCKET_COUNT + 1> m_BucketStart{}; // 桶b的敵人在m_Sorted[start[b], start[b+1])
+};
+
+#endif // CROWDSEPARATION_HPP
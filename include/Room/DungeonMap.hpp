@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "DungeonRoom.hpp"
@@ -17,6 +18,7 @@ class Loader;
 class RoomObjectFactory;
 class Character;
 class DungeonRoom;
+struct RoomPrefab;
 
 struct DungeonMapSpaceInfo
 {
@@ -28,9 +30,18 @@ struct DungeonMapSpaceInfo
 
 struct RoomInfo
 {
-	std::shared_ptr<DungeonRoom> room;
+	std::shared_ptr<DungeonRoom> room; // 還沒建（玩家沒走近過）時爲nullptr
 	RoomType m_RoomType = RoomType::EMPTY;
 	std::array<bool, 4> m_Connections = {false, false, false, false};
+	std::shared_ptr<const RoomPrefab> layout; // 事先選好的佈局（背景規劃時才有）
+};
+
+// 在背景執行緒先規劃好的一關：只有房間類型、連接和選好的佈局，不含任何物件
+struct DungeonPlan
+{
+	std::string theme;
+	int stage = 0;
+	std::array<RoomInfo, 25> rooms;
 };
 
 constexpr std::array<Direction, 4> ALL_DIRECTIONS = {Direction::UP, Direction::RIGHT, Direction::DOWN, Direction::LEFT};
@@ -43,19 +54,28 @@ public:
 		m_RoomObjectFactory(roomObjectFactory), m_Loader(loader), m_Player(player)
 	{
 	}
-	void Start();
+	// plan爲空時當場生成地圖
+	void Start(const std::shared_ptr<const DungeonPlan> &plan = nullptr);
 	void Update();
 
 	// 房間生成
-	bool GenerateMainPath();
+	bool GenerateMainPath(bool isLastStage);
 	bool GenerateBranches(); // 生成分支房間
 
+	// 只做生成地圖的邏輯部分（路徑、分支、佈局選擇），可以在背景執行緒呼叫
+	static std::shared_ptr<const DungeonPlan> GeneratePlan(const std::string &theme, int stage);
+	static bool IsLastStage(const int stage) { return stage == 5; } // 第5關是Boss關
+
 	void SetPlayer(const std::shared_ptr<Character> &player) { m_Player = player; }
 
 	float GetMapHeight() const { return m_SpaceInfo.m_MapHeight; }
 	std::shared_ptr<DungeonRoom> GetCurrentRoom() { return m_CurrentRoom; }
 	std::vector<std::weak_ptr<DungeonRoom>> GetNeighborRooms() const;
 
+	// 延遲建房：RoomInfo只存類型和連接，房間實體在玩家走到相鄰房間時才建
+	std::shared_ptr<DungeonRoom> MaterializeRoom(int index);
+	void MaterializeNeighbors(int index);
+
 	// 小地圖支援：獲取指定索引的房間信息
 	const RoomInfo &GetRoomInfo(int index) const
 	{
@@ -85,7 +105,9 @@ protected:
 	glm::ivec2 Move(const glm::ivec2 &pos, Direction dir);
 	std::optional<Direction> GetRandomValidDirection(const glm::ivec2 &currentPos,
 													 const std::set<Direction> &exclude = {});
-	void SetupRoomConnections(); // 設置房間間的連接關係
+	static int CurrentStage();
+	glm::vec2 GetRoomWorldCoord(int index) const;
+	void SetupRoomConnections(int index); // 設置這個房間和已建好的鄰居之間的連接關係
 	void GenerateAdjacentConnections(); // 生成相鄰房間連接
 };
 
@@ -8,6 +8,8 @@
 #include <array>
 #include <memory>
 #include "Room.hpp"
+#include "Room/GridFlowField.hpp"
+#include "Room/GridPathfinder.hpp"
 
 class CollisionComponent;
 struct Rect;
@@ -18,6 +20,7 @@ class GridSystem;
 class RoomConnectionManager;
 class TerrainGenerator;
 struct CollisionRect;
+struct RoomTerrainPrefab;
 
 // 常量定義
 namespace RoomConstants
@@ -87,6 +90,10 @@ public:
 	bool IsPositionBlocked(int row, int col) const;
 
 	const std::vector<std::vector<int>> &GetGrid() const { return m_Grid; }
+	// 直接換成預先算好的網格（房間預製件）
+	void Assign(const std::vector<std::vector<int>> &grid);
+	// 每次網格內容改動都會遞增，給尋路等快取判斷是否需要重建
+	uint32_t GetVersion() const { return m_Version; }
 
 	// 碰撞檢測相關
 	void UpdateGridFromObjects(const std::vector<std::shared_ptr<nGameObject>> &objects,
@@ -95,6 +102,7 @@ public:
 
 private:
 	std::vector<std::vector<int>> m_Grid;
+	uint32_t m_Version = 0;
 
 	bool IsValidPosition(int row, int col) const;
 };
@@ -153,11 +161,19 @@ public:
 	const std::vector<std::vector<int>> &GetGridData() const;
 	bool IsGridPositionBlocked(int row, int col) const;
 
+	// 尋路服務（網格有變動時會先同步再返回）
+	GridPathfinder *GetPathfinder();
+	// 往玩家的共用流場（每幀在Update開頭同步）
+	const GridFlowField &GetFlowField() const { return *m_FlowField; }
+
 	// 地形生成
 	void CreateCorridorInDirection(Direction dir);
 	void CreateWallInDirection(Direction dir);
 
-	// 房間設置完成後的最終處理
+	// 事先選好的佈局（DungeonPlan），下一次LoadFromJSON用掉；沒有就照常隨機
+	void SetPlannedLayout(const std::shared_ptr<const RoomPrefab> &layout) { m_PlannedLayout = layout; }
+
+	// 房間設置完成後的最終處理（同佈局同通道組合的地形只算一次，見 RoomPrefabCache）
 	void FinalizeRoomSetup();
 
 	// 碰撞優化
@@ -174,6 +190,10 @@ protected:
 	// 初始化方法
 	void InitializeGrid();
 
+	// 地形預製件：從佈局物件算出網格與合併碰撞箱（相對房間中心），再套用到這個房間
+	RoomTerrainPrefab BuildTerrainPrefab() const;
+	void ApplyTerrainPrefab(const RoomTerrainPrefab &terrain);
+
 	// 地形創建輔助方法
 	void CreateWall(int row, int col);
 	void CreateFloor(int row, int col);
@@ -183,6 +203,8 @@ protected:
 	RoomState m_State = RoomState::UNEXPLORED;
 	RoomType m_RoomType;
 	glm::vec2 m_MapGridPos = glm::vec2(0, 0);
+	std::shared_ptr<const RoomPrefab> m_PlannedLayout;
+	uint8_t m_CorridorMask = 0; // 這次佈局建了哪些方向的通道，FinalizeRoomSetup後歸零
 
 	// 門對象容器
 	std::vector<std::shared_ptr<nGameObject>> m_Doors;
@@ -191,6 +213,8 @@ protected:
 	std::unique_ptr<GridSystem> m_GridSystem;
 	std::unique_ptr<RoomConnectionManager> m_ConnectionManager;
 	std::unique_ptr<TerrainGenerator> m_TerrainGenerator;
+	std::unique_ptr<GridPathfinder> m_Pathfinder;
+	std::unique_ptr<GridFlowField> m_FlowField;
 
 private:
 	// 輔助方法
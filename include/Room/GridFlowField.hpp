@@ -0,0 +1,71 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef GRIDFLOWFIELD_HPP
+#define GRIDFLOWFIELD_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Room/GridPathfinder.hpp"
+
+/**
+ * @brief 房間共用的追擊流場（往玩家的Dijkstra積分場）
+ *
+ * 由目標格往外展開一次，每格記下往目標的下一步方向，以及該格是否直接看得到目標。
+ * 只有目標換格或網格版本變動時才重算，任意數量的追擊者取樣都是O(1)，
+ * 一大波敵人或召喚群只花一次流場計算，而不是N次尋路。
+ * 展開規則與GridPathfinder一致（八方向、不切牆角）。
+ */
+class GridFlowField
+{
+public:
+	GridFlowField();
+
+	// 目標換格或網格變動才重算
+	void Update(const GridPathfinder &grid, const glm::vec2 &targetPos);
+	void Invalidate() { m_Valid = false; }
+
+	/**
+	 * @brief O(1)取樣往目標的單位方向
+	 * @return false 表示流場不是為這個目標建的、或該格不可達，呼叫端應改用逐一尋路
+	 */
+	bool Sample(const glm::vec2 &worldPos, const glm::vec2 &targetPos, glm::vec2 &outDirection) const;
+
+	//----Getter----
+	[[nodiscard]] bool IsValid() const { return m_Valid; }
+	[[nodiscard]] glm::ivec2 GetTargetCell() const { return m_TargetCell; }
+	[[nodiscard]] int GetRebuildCount() const { return m_RebuildCount; }
+
+private:
+	static constexpr int GRID_SIZE = GridPathfinder::GRID_SIZE;
+	static constexpr int CELL_COUNT = GRID_SIZE * GRID_SIZE;
+
+	enum CellFlag : uint8_t
+	{
+		REACHABLE = 1 << 0,
+		VISIBLE = 1 << 1, // 格子中心到目標沒有障礙，直接直線走
+	};
+
+	struct HeapEntry
+	{
+		float cost;
+		int16_t index;
+	};
+
+	void Rebuild(const GridPathfinder &grid, const glm::vec2 &targetPos);
+
+	std::array<float, CELL_COUNT> m_Cost{};
+	std::array<glm::vec2, CELL_COUNT> m_Direction{};
+	std::array<uint8_t, CELL_COUNT> m_Flags{};
+	std::vector<HeapEntry> m_Heap; // 預先配置，重算時不再配置
+
+	const GridPathfinder *m_Grid = nullptr;
+	glm::ivec2 m_TargetCell = glm::ivec2(-1);
+	uint32_t m_GridVersion = 0;
+	bool m_Valid = false;
+	int m_RebuildCount = 0;
+};
+
+#endif // GRIDFLOWFIELD_HPP
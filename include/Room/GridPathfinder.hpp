@@ -0,0 +1,136 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef GRIDPATHFINDER_HPP
+#define GRIDPATHFINDER_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "glm/vec2.hpp"
+
+class GridSystem;
+struct RoomSpaceInfo;
+
+/**
+ * @brief 房間網格上的尋路服務（Jump Point Search）
+ *
+ * 每個DungeonRoom各自持有一份，從GridSystem壓成每列一個uint64_t的位元網格（35格剛好塞得下）。
+ * 搜尋用的open list/g值/父節點都是預先配置好的陣列，以世代戳記取代每次查詢的清空，
+ * 穩定之後查詢不會再配置記憶體。
+ * 每幀有查詢上限，超過的請求回傳BUDGET_EXCEEDED，由呼叫端沿用舊路徑、下一幀再試，
+ * 避免一大群追擊者同時重算造成掉幀。
+ *
+ * 斜走只在兩側直向格子都空的時候允許（不切牆角），免得敵人卡在障礙物的角上。
+ * 網格座標一律是 x = col、y = row，與 Tool::WorldToRoomGrid 相同。
+ */
+class GridPathfinder
+{
+public:
+	static constexpr int GRID_SIZE = 35; // 必須等於 RoomConstants::GRID_SIZE
+	static constexpr int MAX_QUERIES_PER_FRAME = 8;
+
+	enum class PathResult
+	{
+		FOUND,
+		NOT_FOUND,
+		BUDGET_EXCEEDED,
+	};
+
+	GridPathfinder();
+
+	// 網格版本不同時才重建位元網格
+	void SyncWith(const GridSystem &grid, const RoomSpaceInfo &spaceInfo);
+	// 每幀開頭由房間呼叫，重置查詢額度
+	void BeginFrame();
+
+	/**
+	 * @brief 由世界座標from尋路到to
+	 * @param outWaypoints 輸出的跳點（世界座標，不含起點），呼叫端持有以重複使用容量
+	 */
+	PathResult FindPath(const glm::vec2 &from, const glm::vec2 &to, std::vector<glm::vec2> &outWaypoints);
+
+	// 線段經過的格子都沒有障礙（超覆蓋走訪，不吃額度）
+	[[nodiscard]] bool HasLineOfSight(const glm::vec2 &from, const glm::vec2 &to) const;
+
+	[[nodiscard]] bool IsBlocked(int row, int col) const;
+	// 把cell夾進網格並挪到兩圈內最近的空格，找不到返回false
+	[[nodiscard]] bool FindNearestWalkable(glm::ivec2 &cell) const;
+	[[nodiscard]] glm::ivec2 WorldToGrid(const glm::vec2 &worldPos) const;
+	[[nodiscard]] glm::vec2 GridToWorld(const glm::ivec2 &grid) const;
+
+	//----Getter----
+	[[nodiscard]] uint32_t GetGridVersion() const { return m_SyncedVersion; }
+	[[nodiscard]] float GetTileSize() const { return m_TileSize; }
+	[[nodiscard]] bool HasBudget() const { return m_QueriesThisFrame < MAX_QUERIES_PER_FRAME; }
+	[[nodiscard]] int GetQueriesThisFrame() const { return m_QueriesThisFrame; }
+	[[nodiscard]] int GetDeferredThisFrame() const { return m_DeferredThisFrame; }
+
+private:
+	static constexpr int CELL_COUNT = GRID_SIZE * GRID_SIZE;
+
+	struct OpenEntry
+	{
+		float f;
+		int16_t index;
+	};
+
+	[[nodiscard]] bool IsWalkable(const int col, const int row) const
+	{
+		return col >= 0 && col < GRID_SIZE && row >= 0 && row < GRID_SIZE && ((m_Blocked[row] >> col) & 1ULL) == 0;
+	}
+
+	[[nodiscard]] int Jump(int col, int row, int dx, int dy) const;
+	void IdentifySuccessors(int index);
+	void PushOpen(int index, float g, int parent);
+	void BuildPath(int goalIndex, std::vector<glm::vec2> &outWaypoints) const;
+
+	std::array<uint64_t, GRID_SIZE> m_Blocked{}; // 每列一個位元組，bit col = 1 表示擋住
+	uint32_t m_SyncedVersion = 0;
+	bool m_HasSynced = false;
+
+	// 世界座標換算（左上角格子中心 + 瓦片大小）
+	glm::vec2 m_Origin = glm::vec2(0.0f);
+	float m_TileSize = 1.0f;
+
+	// 搜尋緩衝（預先配置，以世代戳記失效）
+	std::array<float, CELL_COUNT> m_G{};
+	std::array<int16_t, CELL_COUNT> m_Parent{};
+	std::array<uint32_t, CELL_COUNT> m_Stamp{};	 // == m_Generation 表示本次查詢碰過
+	std::array<uint8_t, CELL_COUNT> m_Closed{};
+	std::vector<OpenEntry> m_Open;				 // 二元堆積，允許重複項目（pop時略過已關閉的）
+	uint32_t m_Generation = 0;
+	int m_GoalIndex = -1;
+
+	int m_QueriesThisFrame = 0;
+	int m_DeferredThisFrame = 0;
+};
+
+/**
+ * @brief 單一AI的路徑跟隨狀態，由移動策略持有
+ *
+ * 看得到目標就直線走（不耗查詢額度）；看不到才查路徑，
+ * 目標換格、網格變動或重算計時到才重查，查不到額度就沿用舊路徑。
+ */
+class PathFollower
+{
+public:
+	/**
+	 * @return 往goal應走的單位方向；無路可走時回傳直線方向
+	 */
+	glm::vec2 Steer(GridPathfinder &pathfinder, const glm::vec2 &position, const glm::vec2 &goal);
+	void Reset();
+
+private:
+	static constexpr float REPATH_INTERVAL = 0.4f;
+
+	std::vector<glm::vec2> m_Waypoints;
+	size_t m_NextWaypoint = 0;
+	glm::ivec2 m_GoalCell = glm::ivec2(-1);
+	uint32_t m_GridVersion = 0;
+	float m_RepathTimer = 0.0f;
+	const GridPathfinder *m_Owner = nullptr; // 換房間就作廢舊路徑
+};
+
+#endif // GRIDPATHFINDER_HPP
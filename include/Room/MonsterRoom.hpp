@@ -5,12 +5,14 @@
 #ifndef MONSTERROOM_HPP
 #define MONSTERROOM_HPP
 
+#include <random>
 #include "DungeonRoom.hpp"
 #include "ObserveManager/EventManager.hpp"
 #include "Structs/DeathEventInfo.hpp"
 
 // 前向聲明
 struct WaveConfig;
+class SpawnAreaTable;
 
 class MonsterRoom final : public DungeonRoom
 {
@@ -144,15 +146,9 @@ private:
 	std::vector<glm::vec2> GenerateSpawnPositions(int count); // 生成隨機位置（向後兼容）
 	std::vector<glm::vec2> GenerateSpawnPositionsWithSize(int count,
 														  const glm::vec2 &entitySize); // 根據實體大小生成位置
-	std::vector<glm::vec2> GenerateSpawnPositionsWithSizeAndExclusions(
-		int count, const glm::vec2 &entitySize,
-		const std::vector<glm::ivec2> &occupiedPositions); // 根據實體大小生成位置並避開已佔用區域
-	bool IsAreaClearForEntity(const glm::ivec2 &gridPos, int entityGridWidth,
-							  int entityGridHeight) const; // 檢查區域是否足夠容納實體
-	bool IsAreaOverlapWithOccupied(const glm::ivec2 &gridPos, int entityGridWidth, int entityGridHeight,
-								   const std::vector<glm::ivec2> &occupiedPositions) const; // 檢查是否與已佔用位置重疊
-	void RecordOccupiedPositions(const glm::vec2 &worldPos, const glm::vec2 &entitySize,
-								 std::vector<glm::ivec2> &occupiedPositions); // 記錄實體佔用的網格位置
+	// 在前綴和表上隨機挑count個放得下的位置並佔用
+	std::vector<glm::vec2> ClaimSpawnPositions(int count, const glm::vec2 &entitySize, SpawnAreaTable &spawnTable,
+											   std::mt19937 &rng) const;
 	glm::vec2 CalculateEntityCenterPosition(const glm::ivec2 &gridPos, const glm::vec2 &entitySize, int entityGridWidth,
 											int entityGridHeight, const glm::vec2 &tileSize, const glm::vec2 &roomCoord,
 											const glm::vec2 &region) const; // 計算實體中心的正確位置
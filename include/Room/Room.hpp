@@ -10,6 +10,7 @@
 #include "json.hpp"
 
 #include "ObserveManager/TrackingManager.hpp"
+#include "AIScheduler.hpp"
 #include "RoomCollisionManager.hpp"
 #include "RoomInteractionManager.hpp"
 
@@ -22,6 +23,7 @@ class Loader;
 class RoomObjectFactory;
 class RoomInteractionManager;
 class RoomCollisionManager;
+struct RoomPrefab;
 namespace Util
 {
 	class Renderer;
@@ -98,11 +100,13 @@ public:
 	void AddRoomObject(const std::shared_ptr<nGameObject> &object);
 	void RemoveRoomObject(const std::shared_ptr<nGameObject> &object);
 	[[nodiscard]] const std::vector<std::shared_ptr<nGameObject>> &GetRoomObjects() const { return m_RoomObjects; }
+	[[nodiscard]] const std::shared_ptr<const RoomPrefab> &GetLayoutPrefab() const { return m_LayoutPrefab; }
 
 	// 碰撞体管理
 	[[nodiscard]] std::shared_ptr<RoomCollisionManager> GetCollisionManager() const { return m_CollisionManager; }
 	[[nodiscard]] std::shared_ptr<RoomInteractionManager> GetInteractionManager() const { return m_InteractionManager; }
 	[[nodiscard]] std::shared_ptr<TrackingManager> GetTrackingManager() const { return m_TrackingManager; }
+	[[nodiscard]] std::shared_ptr<AIScheduler> GetAIScheduler() const { return m_AIScheduler; }
 
 	// Getter/Setter
 	[[nodiscard]] const RoomSpaceInfo &GetRoomSpaceInfo() const { return m_RoomSpaceInfo; }
@@ -133,6 +137,9 @@ protected:
 
 	// 房间内对象
 	std::vector<std::shared_ptr<nGameObject>> m_RoomObjects; // 房间固定物体
+	// 佈局預製件，以及由佈局（和通道）產生的物件，m_RoomObjects的子集
+	std::shared_ptr<const RoomPrefab> m_LayoutPrefab;
+	std::vector<std::shared_ptr<nGameObject>> m_LayoutObjects;
 
 	// === 新的分離角色容器 ===
 	std::vector<std::shared_ptr<Character>> m_Players; // 外部進入的玩家
@@ -151,6 +158,7 @@ protected:
 	std::shared_ptr<RoomCollisionManager> m_CollisionManager = std::make_shared<RoomCollisionManager>();
 	std::shared_ptr<RoomInteractionManager> m_InteractionManager = std::make_shared<RoomInteractionManager>();
 	std::shared_ptr<TrackingManager> m_TrackingManager = std::make_shared<TrackingManager>();
+	std::shared_ptr<AIScheduler> m_AIScheduler = std::make_shared<AIScheduler>();
 	/// @todo 未來可期
 
 	// 緩存引用
@@ -181,11 +189,11 @@ protected:
 	 * @defgroup LoadFromJSON 輔助方法
 	 * @brief JSON 加載相關函數集合
 	 * 功能流程：LoadFromJSON = LoadLobbyObjectPosition + InitializeRoomObjects;
-	 * 其中 LoadLobbyObjectPosition 调用 ReadJsonFile
+	 * 其中 LoadLobbyObjectPosition 經由 RoomPrefabCache 取得解析好的佈局
 	 * @link Room::LoadFromJSON CPP實作位置 @endlink
 	 */
 	[[nodiscard]] nlohmann::json ReadJsonFile(const std::string &filePath) const;
-	void InitializeRoomObjects(const nlohmann::json &jsonData);
+	void InitializeRoomObjects(const std::shared_ptr<const RoomPrefab> &prefab);
 	/// @}
 
 	// 嘗試注冊到管理員
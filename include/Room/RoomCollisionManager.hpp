@@ -9,6 +9,7 @@
 
 #include "ObserveManager/IManager.hpp"
 #include "Room/UniformGrid.hpp"
+#include "Util/WeakIndexedList.hpp"
 
 
 struct CollisionEventInfo;
@@ -20,7 +21,7 @@ public:
 	RoomCollisionManager() {m_SpatialGrid.Initialize(560, 560, 32); };
 	~RoomCollisionManager() override = default;
 
-	// 注冊監聽成員
+	// 注冊監聽成員（O(1)，重複注冊會被忽略）
 	void RegisterNGameObject(const std::shared_ptr<nGameObject>& nGameObject);
 	void UnregisterNGameObject(const std::shared_ptr<nGameObject>& nGameObject);
 
@@ -30,10 +31,13 @@ public:
 	void SetIsActive(const bool isActive) {m_IsActive = isActive;}
 	[[nodiscard]] bool IsActive() const { return m_IsActive; }
 
+	// 已注冊的碰撞物（SoA子彈每幀用來建立碰撞快照）
+	[[nodiscard]] const std::vector<std::weak_ptr<nGameObject>> &GetNGameObjects() const { return m_NGameObjects.Items(); }
+
 protected:
 	UniformGrid m_SpatialGrid;
-	std::vector<std::weak_ptr<nGameObject>> m_NGameObjects;
-	std::vector<std::weak_ptr<nGameObject>> m_TriggerObjects; // 扳機子集局部更新
+	Util::WeakIndexedList<nGameObject> m_NGameObjects;
+	Util::WeakIndexedList<nGameObject> m_TriggerObjects; // 扳機子集局部更新
 	bool m_IsVisible = true; // 記錄碰撞箱顯示
 	bool m_IsActive = true;
 
@@ -0,0 +1,83 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef ROOMPREFABCACHE_HPP
+#define ROOMPREFABCACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Room/CollisionOptimizer.hpp"
+#include "glm/vec2.hpp"
+#include "json.hpp"
+
+class Loader;
+
+// 佈局檔裏的一個物件，位置相對房間中心
+struct RoomPrefabTile
+{
+	std::string id;
+	std::string className;
+	glm::vec2 offset = glm::vec2(0.0f);
+};
+
+// 一份佈局檔（例如 IcePlains/MonsterRoom/2717ObjectPosition_1.json）解析後的結果
+struct RoomPrefab
+{
+	std::string layoutPath;
+	glm::vec2 tileSize = glm::vec2(0.0f);
+	glm::vec2 roomRegion = glm::vec2(0.0f);
+	glm::vec2 roomSize = glm::vec2(0.0f);
+	std::vector<RoomPrefabTile> tiles;
+};
+
+// 佈局加上某種通道組合後算好的地形，座標都相對房間中心
+struct RoomTerrainPrefab
+{
+	std::vector<std::vector<int>> grid;	   // 佈局與通道物件的網格佔用
+	std::vector<CollisionRect> colliders; // 合併後的牆壁碰撞箱
+};
+
+/**
+ * @brief 房間佈局預製件快取
+ *
+ * 佈局檔只有少數幾份，同一份佈局在整個遊戲裏只解析一次；
+ * 網格佔用和牆壁碰撞合併則依「佈局 + 通道方向」各算一次，之後的房間平移到自己的世界座標直接套用。
+ */
+class RoomPrefabCache
+{
+public:
+	static RoomPrefabCache &GetInstance();
+
+	// 讀不到或格式不對時回傳nullptr（不快取失敗結果）
+	std::shared_ptr<const RoomPrefab> GetPrefab(const std::string &layoutPath, Loader &loader);
+
+	// corridorMask：第 static_cast<int>(Direction) 位代表該方向有通道
+	std::shared_ptr<const RoomTerrainPrefab> FindTerrain(const RoomPrefab &prefab, uint8_t corridorMask) const;
+	std::shared_ptr<const RoomTerrainPrefab> StoreTerrain(const RoomPrefab &prefab, uint8_t corridorMask,
+														  RoomTerrainPrefab terrain);
+
+	// 佈局或物件資料改動後呼叫
+	void Clear();
+	// 只丟掉一份佈局（含它的所有地形）；已經拿到的shared_ptr照常可用
+	void Invalidate(const std::string &layoutPath);
+
+	static RoomPrefab ParsePrefab(const std::string &layoutPath, const nlohmann::json &jsonData);
+
+private:
+	RoomPrefabCache() = default;
+	RoomPrefabCache(const RoomPrefabCache &) = delete;
+	RoomPrefabCache &operator=(const RoomPrefabCache &) = delete;
+
+	static std::string TerrainKey(const RoomPrefab &prefab, uint8_t corridorMask);
+
+	mutable std::mutex m_Mutex;
+	std::unordered_map<std::string, std::shared_ptr<const RoomPrefab>> m_Prefabs; // key: 佈局路徑
+	std::unordered_map<std::string, std::shared_ptr<const RoomTerrainPrefab>> m_Terrains; // key: 佈局路徑#通道
+};
+
+#endif // ROOMPREFABCACHE_HPP
@@ -0,0 +1,51 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef SPAWNAREATABLE_HPP
+#define SPAWNAREATABLE_HPP
+
+#include <random>
+#include <vector>
+#include "glm/vec2.hpp"
+
+/**
+ * @brief 生成位置用的二維前綴和表（summed-area table）
+ *
+ * 以房間網格建表一次，之後「某個 寬x高 的區域是否全空」只要四次查表，O(1)。
+ * 每放下一個實體就用Claim把它佔的格子加進表裏（只更新右下象限），
+ * 後面的實體自然會避開，不需要再逐一比對已佔用的格子。
+ * 網格座標一律是 x = col、y = row，與 Tool::WorldToRoomGrid 相同。
+ */
+class SpawnAreaTable
+{
+public:
+	// 非0的格子視爲佔用
+	void Build(const std::vector<std::vector<int>> &grid);
+
+	// [col, col+width) x [row, row+height) 都在網格內且沒有被佔用
+	[[nodiscard]] bool IsFree(int col, int row, int width, int height) const;
+	// 標記區域爲佔用並增量更新前綴和
+	void Claim(int col, int row, int width, int height);
+
+	/**
+	 * @brief 在左上角範圍 [start, end) 內均勻隨機挑一個放得下 width x height 的位置
+	 * @return 沒有位置時回傳false
+	 */
+	bool PickRandom(const glm::ivec2 &start, const glm::ivec2 &end, int width, int height, std::mt19937 &rng,
+					glm::ivec2 &outTopLeft) const;
+
+	[[nodiscard]] int CountBlocked() const { return m_Table.empty() ? 0 : m_Table.back(); }
+	[[nodiscard]] int GetWidth() const { return m_Width; }
+	[[nodiscard]] int GetHeight() const { return m_Height; }
+
+private:
+	// 前綴和索引：(x, y) 代表 col < x 且 row < y 的佔用格數
+	[[nodiscard]] int At(const int x, const int y) const { return m_Table[y * (m_Width + 1) + x]; }
+
+	int m_Width = 0;
+	int m_Height = 0;
+	std::vector<int> m_Table; // (m_Width + 1) x (m_Height + 1)
+};
+
+#endif // SPAWNAREATABLE_HPP
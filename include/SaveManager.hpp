@@ -6,6 +6,10 @@
 #define SAVEMANAGER_HPP
 
 #pragma once
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include "Util/Time.hpp"
 #include "Weapon/Weapon.hpp"
 #include "json.hpp"
@@ -142,6 +146,20 @@ struct SaveData
 	}
 };
 
+// 存檔格式：JSON方便除錯；MSGPACK是同一份資料的精簡二進位版（nlohmann::json::to_msgpack）
+enum class SaveFormat
+{
+	JSON,
+	MSGPACK
+};
+
+/**
+ * @brief 存檔管理
+ *
+ * SaveGame只在主執行緒複製一份SaveData快照，序列化和寫檔交給背景寫檔執行緒；
+ * 還沒寫的快照只留最新一份，連續存好幾次只會寫最後一次，內容和上次寫入相同就不寫。
+ * 寫檔先寫暫存檔、刷到磁碟後再改名蓋過正式存檔，寫到一半當掉也只會留下舊存檔。
+ */
 class SaveManager
 {
 public:
@@ -156,17 +174,37 @@ public:
 	[[nodiscard]] std::shared_ptr<SaveData> GetSaveData() const { return saveSlot; } // 获取存档信息
 	[[nodiscard]] bool HasSaveData() const; // 检查是否有存档
 
+	[[nodiscard]] SaveFormat GetSaveFormat() const { return saveFormat; }
+
 	//====Setter====
-	bool SaveGame(const std::shared_ptr<SaveData> &saveData); // 保存游戲
+	bool SaveGame(const std::shared_ptr<SaveData> &saveData); // 保存游戲（只排入背景寫檔，不等寫完）
 	bool DeleteSave(); // 刪除存檔
+	void Flush(); // 等背景寫檔全部完成（離開遊戲前呼叫）
+	void SetSaveFormat(const SaveFormat format) { saveFormat = format; }
 
 
 private:
 	std::string saveDirectory;
 	std::shared_ptr<SaveData> saveSlot;
+#ifdef SAVE_FORMAT_MSGPACK
+	SaveFormat saveFormat = SaveFormat::MSGPACK;
+#else
+	SaveFormat saveFormat = SaveFormat::JSON;
+#endif
+
+	// 背景寫檔
+	mutable std::mutex writerMutex;
+	std::condition_variable writerWakeUp; // 有新快照或要結束
+	std::condition_variable writerIdle; // 寫完、沒有待寫的快照
+	std::optional<std::pair<SaveData, SaveFormat>> pendingSnapshot; // 只留最新一份
+	bool isWriting = false;
+	bool stopWriter = false;
+	std::string lastWritten; // 上次寫入的內容，相同就略過
+	std::thread writerThread;
 
 	// 單例模式：私有構造函數
 	explicit SaveManager(const std::string &saveDir = "../saves/");
+	~SaveManager();
 
 	// 禁用拷貝構造和賦值操作
 	SaveManager(const SaveManager &) = delete;
@@ -174,6 +212,11 @@ private:
 
 	void CreateSaveDirectory() const;
 	void LoadSaveData();
+	[[nodiscard]] std::string GetSaveFilePath(SaveFormat format) const;
+	[[nodiscard]] static bool ReadSaveFile(const std::string &filename, SaveFormat format, nlohmann::json &j);
+	void WriterLoop();
+	void WriteSnapshot(const SaveData &snapshot, SaveFormat format);
+	static bool WriteFileAtomically(const std::string &filename, const std::string &content);
 	static std::string GetCurrentTimeString();
 };
 
@@ -5,12 +5,14 @@
 #ifndef DUNGEON_HPP
 #define DUNGEON_HPP
 
+#include <future>
 #include "Scene/Scene.hpp"
 #include "Util/BGM.hpp"
 #include "Util/SFX.hpp"
 
 
 class DungeonMap;
+struct DungeonPlan;
 class MonsterRoomTestUI;
 class KeyPanel;
 
@@ -25,8 +27,9 @@ public:
 	void Exit() override;
 	SceneType Change() override;
 
-	static void GenerateStaticDungeon();
-	static std::shared_ptr<DungeonScene> GetPreGenerated();
+	// 下一關的地圖規劃在背景執行緒生成；進入下一關時取用（主題或關卡不符就回傳nullptr）
+	static void GenerateStaticDungeon(const std::string &theme, int stage);
+	static std::shared_ptr<const DungeonPlan> GetPreGenerated(const std::string &theme, int stage);
 	static void ClearPreGenerated();
 	std::shared_ptr<Character> GetPlayer() const { return m_Player; }
 
@@ -34,7 +37,7 @@ public:
 	void OnStageCompleted();
 
 private:
-	static std::shared_ptr<DungeonScene> s_PreGeneratedInstance;
+	static std::future<std::shared_ptr<const DungeonPlan>> s_PreGeneratedPlan;
 
 	std::shared_ptr<Character> m_Player;
 	bool m_IsPlayerDeath = false;
@@ -65,6 +68,8 @@ private:
 	// Debug UI 控制
 	bool m_ShowDebugUI = false; // 是否顯示 debug UI
 
+	size_t m_HotReloadListenerID = 0; // ContentHotReload 的訂閱
+
 	void CreatePlayer();
 	void SetupCamera() const;
 	void InitializeSceneManagers();
@@ -79,14 +84,12 @@ private:
 	void HandleLayoutChangeInput(); // 處理佈局更換輸入
 	void ProcessLayoutChangeRequest(); // 處理佈局更換請求
 	void ChangeCurrentRoomLayout(const std::string &layoutName); // 更換當前房間佈局
+	void OnContentReloaded(const std::string &relativePath); // json改動後重建目前的房間
 	void InitializeMonsterRoomTestUI(); // 初始化測試UI
 
 	// 玩家ShowUp相關
 	void TriggerPlayerShowUp(); // 觸發玩家顯示事件
 
-	// 以下為你原本地牢生成的函數
-	void BuildDungeon(); // 房間生成與初始化邏輯
-
 protected:
 };
 
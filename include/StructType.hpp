@@ -5,7 +5,9 @@
 #ifndef STRUCTTYPE_HPP
 #define STRUCTTYPE_HPP
 
+#include <cstdint>
 #include <memory>
+#include "glm/vec2.hpp"
 class Character;
 class MovementComponent;
 class StateComponent;
@@ -32,4 +34,16 @@ struct EnemyContext {
 	std::shared_ptr<AIComponent> GetAIComp() const;
 };
 
+// AI排程器平行階段依唯讀快照算好的感知結果，思考時直接取用
+struct AIPerception {
+	glm::vec2 targetPos = glm::vec2(0.0f);
+	float targetDistance = 0.0f;
+	glm::vec2 flowDirection = glm::vec2(0.0f); // 往目標的移動方向（流場取樣）
+	bool hasTarget = false;
+	bool hasLineOfSight = true; // 網格上看得到目標
+	glm::vec2 aimPoint = glm::vec2(0.0f); // 槍械的提前量瞄準點（TargetPredictor）
+	bool hasFlowDirection = false;
+	bool hasAimPoint = false;
+};
+
 #endif //STRUCTTYPE_HPP
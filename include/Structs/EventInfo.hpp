@@ -5,6 +5,7 @@
 #ifndef EVENTINFO_HPP
 #define EVENTINFO_HPP
 
+#include <cstddef>
 #include <typeindex>
 
 // EventManager 和 Component分兩類？
@@ -55,7 +56,7 @@ enum class EventType
 
 	// 角色顯示相關
 	ShowUp,
-	Hide
+	Hide,
 	// HealthChanged,
 	// EnergyChanged,
 	// ArmorBroken,
@@ -77,8 +78,12 @@ enum class EventType
 	// ShowGameOverScreen,
 
 	// 自由擴充...
+
+	Count // 事件種類數量，必須保持在最後（nGameObject訂閲表的陣列大小）
 };
 
+constexpr std::size_t EventTypeCount = static_cast<std::size_t>(EventType::Count);
+
 struct EventInfo
 {
 	explicit EventInfo(const EventType type) : m_EventType(type) {}
@@ -0,0 +1,40 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef OBJECTDATASTRUCT_HPP
+#define OBJECTDATASTRUCT_HPP
+
+#include <string>
+#include <vector>
+#include "EnumTypes.hpp"
+#include "Structs/CollisionComponentStruct.hpp"
+#include "glm/vec2.hpp"
+#include "json.hpp"
+
+// ObjectData裏的一個元件：碰撞箱（幾乎每個牆/地板都有）預先解析，其他元件保留json交給Factory::createComponent
+struct StructObjectComponent
+{
+	bool isCollision = false;
+	StructCollisionComponent collision;
+	nlohmann::json json;
+};
+
+// json/<Theme>/ObjectData/<id>.json 解析後的結果，同主題只解析一次
+struct StructObjectData
+{
+	bool isAnimated = false;
+	bool hasWillPlay = false;
+	bool willPlay = true;
+	bool hasPath = false;
+	bool pathIsArray = false;
+	std::vector<std::string> paths;			// json原樣；單張圖片也放在這裏
+	std::vector<std::string> resourcePaths; // 已加上RESOURCE_DIR
+	bool hasZIndex = false;
+	ZIndexType zIndex = ZIndexType::CUSTOM;
+	bool hasPosOffset = false;
+	glm::vec2 posOffset = glm::vec2(0.0f);
+	std::vector<StructObjectComponent> components;
+};
+
+#endif // OBJECTDATASTRUCT_HPP
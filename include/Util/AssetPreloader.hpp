@@ -0,0 +1,46 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef ASSETPRELOADER_HPP
+#define ASSETPRELOADER_HPP
+
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct SDL_Surface;
+
+namespace Util
+{
+	/**
+	 * @brief 啟動時的背景預載
+	 *
+	 * Start在建立視窗和GL環境之前呼叫：依 json/StartupPreload.json 列出的資料夾，
+	 * 在背景執行緒解碼主選單和大廳會用到的圖片，並先解析大廳佈局；
+	 * Install在主執行緒把解好的圖片交給Util::Image的快取，之後建Image只剩上傳貼圖。
+	 */
+	class AssetPreloader
+	{
+	public:
+		static AssetPreloader &GetInstance();
+
+		void Start(const std::string &configPath);
+		// 等背景工作做完並安裝結果；沒呼叫過Start就什麼都不做
+		void Install();
+
+	private:
+		AssetPreloader() = default;
+		AssetPreloader(const AssetPreloader &) = delete;
+		AssetPreloader &operator=(const AssetPreloader &) = delete;
+
+		using DecodedImage = std::pair<std::string, std::shared_ptr<SDL_Surface>>;
+
+		std::vector<std::future<std::vector<DecodedImage>>> m_ImageTasks;
+		std::vector<std::future<void>> m_LayoutTasks;
+	};
+} // namespace Util
+
+#endif // ASSETPRELOADER_HPP
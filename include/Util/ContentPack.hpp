@@ -0,0 +1,211 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef CONTENTPACK_HPP
+#define CONTENTPACK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include "json.hpp"
+
+namespace Util
+{
+	/**
+	 * @brief json/ 目錄編譯後的二進位內容包格式（ContentPackBuilder產生，小端序）
+	 *
+	 * [Header][FileEntry x fileCount（依pathHash排序）][Node x nodeCount][字串表]
+	 * 每份json攤平成Node陣列：物件/陣列的子節點連續排放，物件的子節點各自帶著key，
+	 * 字串與key都只存字串表的位移，同樣的字串只存一次。
+	 * 版本不合或檔案損壞時執行期直接不用內容包，退回讀文字json。
+	 */
+	namespace ContentPackFormat
+	{
+		constexpr uint32_t MAGIC = 0x50434B53; // "SKCP"
+		constexpr uint32_t VERSION = 1;
+
+		enum class NodeType : uint8_t
+		{
+			NUL,
+			BOOLEAN,
+			INTEGER,
+			UNSIGNED,
+			FLOAT,
+			STRING,
+			ARRAY,
+			OBJECT
+		};
+
+		struct Header
+		{
+			uint32_t magic = MAGIC;
+			uint32_t version = VERSION;
+			uint32_t fileCount = 0;
+			uint32_t nodeCount = 0;
+			uint64_t fileTableOffset = 0;
+			uint64_t nodeTableOffset = 0;
+			uint64_t stringTableOffset = 0;
+			uint64_t stringTableSize = 0;
+		};
+
+		struct FileEntry
+		{
+			uint64_t pathHash = 0;
+			uint32_t pathOffset = 0; // 相對json/的路徑，例如 "IcePlains/ObjectData/w600.json"
+			uint32_t pathLength = 0;
+			uint32_t root = 0; // 根節點索引
+			uint32_t reserved = 0;
+		};
+
+		struct Node
+		{
+			NodeType type = NodeType::NUL;
+			uint8_t reserved[3]{};
+			uint32_t keyOffset = 0; // 物件成員的key（非成員時爲0長度）
+			uint32_t keyLength = 0;
+			uint32_t count = 0; // STRING：長度；ARRAY/OBJECT：子節點數
+			union
+			{
+				int64_t integer = 0;
+				uint64_t unsignedInteger;
+				double number;
+				uint64_t offset; // STRING：字串表位移；ARRAY/OBJECT：第一個子節點索引
+				uint64_t boolean;
+			};
+		};
+
+		static_assert(sizeof(Header) == 48 && sizeof(FileEntry) == 24 && sizeof(Node) == 24,
+					  "ContentPack layout must not depend on the compiler");
+
+		// FNV-1a 64
+		constexpr uint64_t HashPath(const std::string_view path)
+		{
+			uint64_t hash = 14695981039346656037ull;
+			for (const char c : path)
+			{
+				hash ^= static_cast<uint8_t>(c);
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+	} // namespace ContentPackFormat
+
+	class ContentPack;
+
+	// 內容包裏某個json值的唯讀視圖，不複製任何資料；內容包關閉後失效
+	class ContentValue
+	{
+	public:
+		ContentValue() = default;
+
+		explicit operator bool() const { return m_Node != nullptr; }
+		[[nodiscard]] bool IsNull() const { return Is(ContentPackFormat::NodeType::NUL); }
+		[[nodiscard]] bool IsBool() const { return Is(ContentPackFormat::NodeType::BOOLEAN); }
+		[[nodiscard]] bool IsNumber() const;
+		[[nodiscard]] bool IsString() const { return Is(ContentPackFormat::NodeType::STRING); }
+		[[nodiscard]] bool IsArray() const { return Is(ContentPackFormat::NodeType::ARRAY); }
+		[[nodiscard]] bool IsObject() const { return Is(ContentPackFormat::NodeType::OBJECT); }
+
+		// 陣列/物件的元素數
+		[[nodiscard]] size_t Size() const;
+		// 第index個子節點（陣列元素或物件成員）
+		[[nodiscard]] ContentValue At(size_t index) const;
+		// 物件成員；找不到回傳無效的視圖
+		[[nodiscard]] ContentValue operator[](std::string_view key) const;
+		[[nodiscard]] bool Contains(const std::string_view key) const { return static_cast<bool>((*this)[key]); }
+		// 身爲物件成員時的key
+		[[nodiscard]] std::string_view Key() const;
+
+		[[nodiscard]] bool GetBool() const;
+		[[nodiscard]] int64_t GetInt() const;
+		[[nodiscard]] double GetFloat() const;
+		[[nodiscard]] std::string_view GetString() const;
+
+		// 轉回json（給還在吃nlohmann::json的舊程式碼；只建DOM，不做文字解析）
+		// JsonT：nlohmann::json 或 nlohmann::ordered_json
+		template <typename JsonT = nlohmann::ordered_json>
+		[[nodiscard]] JsonT ToJson() const;
+
+	private:
+		friend class ContentPack;
+		ContentValue(const ContentPack *pack, const ContentPackFormat::Node *node) : m_Pack(pack), m_Node(node) {}
+
+		[[nodiscard]] bool Is(const ContentPackFormat::NodeType type) const { return m_Node && m_Node->type == type; }
+
+		const ContentPack *m_Pack = nullptr;
+		const ContentPackFormat::Node *m_Node = nullptr;
+	};
+
+	/**
+	 * @brief 執行期的內容包：整個檔案mmap進來，查表回傳零拷貝的ContentValue
+	 *
+	 * 內容包由建置時的ContentPack目標產生（CONTENT_PACK_PATH），找不到就等於沒開，
+	 * 所有讀json的地方照舊讀文字檔。
+	 */
+	class ContentPack
+	{
+	public:
+		static ContentPack &GetInstance();
+
+		ContentPack() = default;
+		~ContentPack();
+		ContentPack(const ContentPack &) = delete;
+		ContentPack &operator=(const ContentPack &) = delete;
+
+		bool Open(const std::string &filePath);
+		void Close();
+		[[nodiscard]] bool IsOpen() const { return m_Data != nullptr; }
+
+		// relativePath相對json/；也接受開頭是JSON_DIR的完整路徑
+		[[nodiscard]] ContentValue Find(std::string_view path) const;
+		// 有在內容包裏就轉成json回傳true，否則不動out
+		template <typename JsonT>
+		bool TryLoadJson(const std::string_view path, JsonT &out) const
+		{
+			const ContentValue root = Find(path);
+			if (!root)
+				return false;
+			out = root.ToJson<JsonT>();
+			return true;
+		}
+
+		[[nodiscard]] size_t GetFileCount() const { return m_Header ? m_Header->fileCount : 0; }
+
+		// 熱重載：這個檔案在磁碟上改過，之後Find不再回傳內容包裏的舊版本（改讀文字檔）
+		void Override(std::string_view path);
+
+	private:
+		// 去掉JSON_DIR和開頭的斜線，變成內容包裏的相對路徑
+		static std::string_view ToPackPath(std::string_view path);
+		// 開檔時檢查一次所有索引與位移都落在檔案內，之後查表不必再檢查
+		[[nodiscard]] bool ValidateTables() const;
+
+		friend class ContentValue;
+
+		[[nodiscard]] std::string_view String(const uint64_t offset, const uint64_t length) const
+		{
+			return {m_Strings + offset, static_cast<size_t>(length)};
+		}
+
+		const uint8_t *m_Data = nullptr;
+		size_t m_Size = 0;
+		const ContentPackFormat::Header *m_Header = nullptr;
+		const ContentPackFormat::FileEntry *m_Files = nullptr;
+		const ContentPackFormat::Node *m_Nodes = nullptr;
+		const char *m_Strings = nullptr;
+		std::atomic<bool> m_HasOverrides{false}; // 沒有覆寫時Find不必上鎖
+		mutable std::mutex m_OverrideMutex;
+		std::unordered_set<std::string> m_Overridden;
+#ifdef _WIN32
+		void *m_FileHandle = nullptr;
+		void *m_MappingHandle = nullptr;
+#endif
+	};
+} // namespace Util
+
+#endif // CONTENTPACK_HPP
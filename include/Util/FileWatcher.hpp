@@ -0,0 +1,49 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef FILEWATCHER_HPP
+#define FILEWATCHER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Util
+{
+	/**
+	 * @brief 監看一個資料夾（含子資料夾）裏檔案的改動
+	 *
+	 * Linux用inotify（寫完關檔或改名蓋過才算一次改動），其他平台每隔pollInterval比對一次修改時間。
+	 * 背景執行緒收集改動，主執行緒呼叫TakeChanges取走；取走之前同一個檔案改幾次都只回報一次。
+	 */
+	class FileWatcher
+	{
+	public:
+		explicit FileWatcher(std::string rootDirectory,
+							 std::chrono::milliseconds pollInterval = std::chrono::milliseconds(300));
+		~FileWatcher();
+		FileWatcher(const FileWatcher &) = delete;
+		FileWatcher &operator=(const FileWatcher &) = delete;
+
+		// 相對rootDirectory、以'/'分隔的路徑，例如 "IcePlains/ObjectData/w600.json"
+		std::vector<std::string> TakeChanges();
+
+	private:
+		void Run();
+		void Push(std::string relativePath);
+
+		const std::string m_Root;
+		const std::chrono::milliseconds m_PollInterval;
+		std::mutex m_Mutex;
+		std::set<std::string> m_Changes;
+		std::atomic<bool> m_Stop{false};
+		std::thread m_Thread;
+	};
+} // namespace Util
+
+#endif // FILEWATCHER_HPP
@@ -0,0 +1,121 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef MPSCRINGBUFFER_HPP
+#define MPSCRINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Util
+{
+	/**
+	 * @brief 固定容量的多生產者/單消費者無鎖環形佇列
+	 *
+	 * 每個槽位帶一個序號（Vyukov bounded queue），生產者用CAS搶位置後直接寫入預先配置好的槽位，
+	 * 消費者（主執行緒）每幀用Drain一次取出。槽位裏的T在整個生命週期內重複使用，
+	 * 所以像std::string這類成員在暖機後不會再配置記憶體。
+	 * @tparam T 元素型別，需可預設建構與拷貝賦值
+	 * @tparam Capacity 容量，必須是2的次方
+	 */
+	template <typename T, std::size_t Capacity>
+	class MpscRingBuffer
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+	public:
+		MpscRingBuffer() : m_Slots(std::make_unique<Slot[]>(Capacity))
+		{
+			for (std::size_t i = 0; i < Capacity; ++i)
+				m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		~MpscRingBuffer() = default;
+
+		MpscRingBuffer(const MpscRingBuffer &) = delete;
+		MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+
+		/**
+		 * @brief 任意執行緒都可以呼叫，佇列滿時返回false
+		 */
+		bool TryPush(const T &value)
+		{
+			return TryEmplace([&value](T &slot) { slot = value; });
+		}
+
+		/**
+		 * @brief 搶到槽位後由writer直接寫入槽位裏的T（批次生成時只改少數欄位，不必先建一份暫存）
+		 * 佇列滿時返回false，writer不會被呼叫
+		 */
+		template <typename Writer>
+		bool TryEmplace(Writer &&writer)
+		{
+			std::size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			Slot *slot = nullptr;
+			for (;;)
+			{
+				slot = &m_Slots[pos & (Capacity - 1)];
+				const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+				const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+				if (diff == 0)
+				{
+					if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					return false; // 消費者還沒取走這一圈的資料 -> 滿了
+				}
+				else
+				{
+					pos = m_EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+			writer(slot->data);
+			slot->sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief 只能由單一消費者呼叫，把呼叫當下已寫入的元素依序交給func
+		 * 處理過程中新推入的元素留到下一次Drain，避免一邊生成一邊消化造成無限迴圈
+		 * @return 處理的數量
+		 */
+		template <typename Func>
+		std::size_t Drain(Func &&func)
+		{
+			const std::size_t limit = m_EnqueuePos.load(std::memory_order_acquire);
+			std::size_t count = 0;
+			while (m_DequeuePos != limit)
+			{
+				Slot &slot = m_Slots[m_DequeuePos & (Capacity - 1)];
+				// 位置已被搶到但資料還沒寫完，下一幀再處理
+				if (slot.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1)
+					break;
+				func(slot.data);
+				slot.sequence.store(m_DequeuePos + Capacity, std::memory_order_release);
+				++m_DequeuePos;
+				++count;
+			}
+			return count;
+		}
+
+		[[nodiscard]] bool Empty() const { return m_EnqueuePos.load(std::memory_order_acquire) == m_DequeuePos; }
+		[[nodiscard]] static constexpr std::size_t GetCapacity() { return Capacity; }
+
+	private:
+		struct Slot
+		{
+			std::atomic<std::size_t> sequence{0};
+			T data{};
+		};
+
+		std::unique_ptr<Slot[]> m_Slots;
+		alignas(64) std::atomic<std::size_t> m_EnqueuePos{0};
+		alignas(64) std::size_t m_DequeuePos = 0; // 只有消費者會碰
+	};
+} // namespace Util
+
+#endif // MPSCRINGBUFFER_HPP
@@ -0,0 +1,81 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef STARTUPTRACE_HPP
+#define STARTUPTRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Util
+{
+	/**
+	 * @brief 啟動階段計時，輸出成Chrome trace（chrome://tracing 或 ui.perfetto.dev 可開）
+	 *
+	 * 時間從第一次呼叫GetInstance起算，main一開始就先叫一次。
+	 * 平常只在log印一行總啟動時間；設了環境變數 SOULKNIGHT_STARTUP_TRACE=<輸出路徑> 才記錄各階段，
+	 * 各執行緒都可以記錄，Finish時寫出trace檔並把主執行緒的各階段印在log。
+	 * 沒開或Finish之後就不再記錄，Scope不花任何成本。
+	 */
+	class StartupTrace
+	{
+	public:
+		// 一個具名階段，建構時開始、解構或End()時結束
+		class Scope
+		{
+		public:
+			explicit Scope(std::string name);
+			~Scope() { End(); }
+			Scope(const Scope &) = delete;
+			Scope &operator=(const Scope &) = delete;
+
+			void End();
+
+		private:
+			std::string m_Name;
+			int64_t m_StartUs = -1; // -1：已結束或沒在記錄
+		};
+
+		static StartupTrace &GetInstance();
+
+		[[nodiscard]] bool IsRecording() const { return m_Recording.load(std::memory_order_relaxed); }
+		[[nodiscard]] int64_t NowUs() const;
+
+		void Record(const std::string &name, int64_t startUs, int64_t endUs);
+		void Mark(const std::string &name); // 瞬間事件
+
+		// 印出總啟動時間，有開trace就寫出trace檔；停止記錄，只有第一次呼叫有作用
+		void Finish();
+
+	private:
+		struct Event
+		{
+			std::string name;
+			char phase = 'X'; // X：區間，i：瞬間
+			int64_t startUs = 0;
+			int64_t durationUs = 0;
+			uint32_t thread = 0;
+		};
+
+		StartupTrace();
+
+		uint32_t ThreadIndex(); // 需持有m_Mutex；主執行緒（建立實例的）是0
+
+		const std::chrono::steady_clock::time_point m_Origin;
+		const std::string m_TracePath; // 空字串：沒開trace
+		std::atomic<bool> m_Recording;
+		std::atomic<bool> m_Finished{false};
+		std::mutex m_Mutex;
+		std::vector<Event> m_Events;
+		std::unordered_map<std::thread::id, uint32_t> m_Threads;
+	};
+} // namespace Util
+
+#endif // STARTUPTRACE_HPP
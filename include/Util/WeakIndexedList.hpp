@@ -0,0 +1,112 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef WEAKINDEXEDLIST_HPP
+#define WEAKINDEXEDLIST_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Util
+{
+	/**
+	 * @brief 帶索引表的weak_ptr清單，新增/移除都是O(1)
+	 *
+	 * 以物件位址當key記錄它在陣列中的位置，移除時把最後一個元素搬到空位（swap-and-pop），
+	 * 所以順序不保證。已過期的weak_ptr在ForEachAlive時順手清掉。
+	 * 同一個物件只會出現一次。
+	 */
+	template <typename T>
+	class WeakIndexedList
+	{
+	public:
+		/**
+		 * @return 已經在清單裏就返回false
+		 */
+		bool Add(const std::shared_ptr<T> &object)
+		{
+			if (!object)
+				return false;
+			const T *key = object.get();
+			if (const auto it = m_Indices.find(key); it != m_Indices.end())
+			{
+				// 舊物件已銷毀、新物件剛好配置在同一位址 -> 直接沿用槽位
+				if (!m_Items[it->second].expired())
+					return false;
+				m_Items[it->second] = object;
+				return true;
+			}
+			m_Indices.emplace(key, m_Items.size());
+			m_Items.emplace_back(object);
+			m_Keys.push_back(key);
+			return true;
+		}
+
+		bool Remove(const T *object)
+		{
+			const auto it = m_Indices.find(object);
+			if (it == m_Indices.end())
+				return false;
+			const size_t index = it->second;
+			m_Indices.erase(it);
+			RemoveAt(index);
+			return true;
+		}
+
+		[[nodiscard]] bool Contains(const T *object) const { return m_Indices.count(object) > 0; }
+
+		/**
+		 * @brief 依序走訪還活著的物件，過期的順手移除
+		 * 走訪期間func不應該直接Add/Remove這個清單（請延後處理）
+		 */
+		template <typename Func>
+		void ForEachAlive(Func &&func)
+		{
+			size_t i = 0;
+			while (i < m_Items.size())
+			{
+				auto object = m_Items[i].lock();
+				if (!object)
+				{
+					m_Indices.erase(m_Keys[i]);
+					RemoveAt(i); // 最後一個搬進來，同一個i再檢查一次
+					continue;
+				}
+				func(object);
+				++i;
+			}
+		}
+
+		void Clear()
+		{
+			m_Items.clear();
+			m_Keys.clear();
+			m_Indices.clear();
+		}
+
+		[[nodiscard]] size_t Size() const { return m_Items.size(); }
+		[[nodiscard]] const std::vector<std::weak_ptr<T>> &Items() const { return m_Items; }
+
+	private:
+		void RemoveAt(const size_t index)
+		{
+			const size_t last = m_Items.size() - 1;
+			if (index != last)
+			{
+				m_Items[index] = std::move(m_Items[last]);
+				m_Keys[index] = m_Keys[last];
+				m_Indices[m_Keys[index]] = index;
+			}
+			m_Items.pop_back();
+			m_Keys.pop_back();
+		}
+
+		std::vector<std::weak_ptr<T>> m_Items;
+		std::vector<const T *> m_Keys; // 與m_Items平行，過期的weak_ptr也能找回自己的key
+		std::unordered_map<const T *, size_t> m_Indices;
+	};
+} // namespace Util
+
+#endif // WEAKINDEXEDLIST_HPP
@@ -0,0 +1,85 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Util
+{
+	/**
+	 * @brief 依硬體執行緒數建立的work-stealing執行緒池
+	 *
+	 * 每個工作執行緒有自己的佇列，從前端取自己的工作、閒下來就從別人佇列的尾端偷。
+	 * ParallelFor把區間切成固定大小的塊平均分到各佇列，呼叫端（主執行緒）也會一起偷工作做，
+	 * 全部做完才返回，所以回呼裏可以安全引用呼叫端的區域變數。
+	 * 只給主執行緒提交；回呼不可拋出例外，也不可再呼叫ParallelFor。
+	 */
+	class WorkStealingPool
+	{
+	public:
+		using RangeFunc = std::function<void(std::size_t begin, std::size_t end)>;
+
+		// 全程式共用一份，工作執行緒數 = 硬體執行緒數 - 1（主執行緒也會參與）
+		static WorkStealingPool &GetInstance();
+
+		explicit WorkStealingPool(std::size_t workerCount);
+		~WorkStealingPool();
+
+		WorkStealingPool(const WorkStealingPool &) = delete;
+		WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+		/**
+		 * @brief 平行處理[0, count)，每塊最多grain個
+		 * 數量不到一塊或沒有工作執行緒時直接在呼叫端執行
+		 */
+		void ParallelFor(std::size_t count, std::size_t grain, const RangeFunc &func);
+
+		[[nodiscard]] std::size_t GetWorkerCount() const { return m_Workers.size(); }
+
+	private:
+		struct Job
+		{
+			const RangeFunc *func = nullptr;
+			std::atomic<std::size_t> remaining{0};
+		};
+
+		struct Task
+		{
+			Job *job = nullptr;
+			std::size_t begin = 0;
+			std::size_t end = 0;
+		};
+
+		struct WorkQueue
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		void WorkerLoop(std::size_t index);
+		bool PopLocal(std::size_t index, Task &task);
+		bool Steal(std::size_t thiefIndex, Task &task);
+		void Run(const Task &task);
+
+		std::vector<std::unique_ptr<WorkQueue>> m_Queues; // 最後一個給呼叫端用
+		std::vector<std::thread> m_Workers;
+
+		std::mutex m_SleepMutex;
+		std::condition_variable m_WakeCondition;
+		std::atomic<std::size_t> m_Pending{0}; // 還在佇列裏的工作數
+		std::atomic<bool> m_Stop{false};
+	};
+} // namespace Util
+
+#endif // WORKSTEALINGPOOL_HPP
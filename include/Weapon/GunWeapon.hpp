@@ -26,6 +26,9 @@ public:
 	void attack(int damage, bool isCriticalHit = false) override;
 	std::shared_ptr<Weapon> Clone() const override { return std::make_shared<GunWeapon>(*this); }
 
+	[[nodiscard]] float GetBulletSpeed() const { return m_projectileInfo.speed; }
+	[[nodiscard]] bool IsBulletTracking() const { return m_bulletCanTracking; }
+
 
 private:
 	int m_numOfBullets;
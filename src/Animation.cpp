@@ -10,32 +10,35 @@ Animation::Animation(const std::vector<std::string> &AnimationPaths, bool needLo
 	m_AnimationPaths(AnimationPaths), m_Looping(needLoop), nGameObject("Animation", _class)
 {
 	if (interval == 0)
-	{
-		if (const int frameCount = m_AnimationPaths.size(); frameCount > 0)
-		{
-			if (frameCount <= 2)
-			{
-				interval = 250.0f; // 4FPS
-			}
-			else if (frameCount <= 5)
-			{
-				interval = 125.0f; // 8FPS
-			}
-			else
-			{
-				interval = 1000.0f / (frameCount + 10);
-				interval = std::clamp(interval, 50.0f, 100.0f);
-			}
-		}
-		else
-		{
-			LOG_ERROR("Animation::PlayAnimation: AnimationPaths is empty");
-		}
-	}
+		interval = DefaultInterval(m_AnimationPaths.size());
 	m_Drawable = std::make_shared<Util::Animation>(m_AnimationPaths, false, interval, m_Looping, 0);
 	this->SetZIndexType(ZIndexType::CUSTOM);
 }
 
+Animation::Animation(std::vector<std::shared_ptr<Util::Image>> frames, bool needLoop, float interval,
+					const std::string &_class) :
+	m_Looping(needLoop), nGameObject("Animation", _class)
+{
+	if (interval == 0)
+		interval = DefaultInterval(frames.size());
+	m_Drawable = std::make_shared<Util::Animation>(std::move(frames), false, interval, m_Looping, 0);
+	this->SetZIndexType(ZIndexType::CUSTOM);
+}
+
+float Animation::DefaultInterval(const size_t frameCount)
+{
+	if (frameCount == 0)
+	{
+		LOG_ERROR("Animation::PlayAnimation: AnimationPaths is empty");
+		return 0.0f;
+	}
+	if (frameCount <= 2)
+		return 250.0f; // 4FPS
+	if (frameCount <= 5)
+		return 125.0f; // 8FPS
+	return std::clamp(1000.0f / (frameCount + 10), 50.0f, 100.0f);
+}
+
 bool Animation::IfAnimationEnds() const
 {
 	auto animation = std::dynamic_pointer_cast<Util::Animation>(m_Drawable);
@@ -3,18 +3,62 @@
 //
 
 #include "Attack/AttackManager.hpp"
-#include <execution>
-#include <thread>
 
 #include "Room/RoomCollisionManager.hpp"
 #include "Scene/SceneManager.hpp"
 
+AttackManager::AttackManager(const AttackPoolConfig& poolConfig) :
+	m_projectilePool(poolConfig.projectilePrewarm, poolConfig.growStep),
+	m_effectPool(poolConfig.effectPrewarm, poolConfig.growStep)
+{
+}
+
 void AttackManager::spawnProjectile(const ProjectileInfo& projectileInfo)
 {
-	// 將生成操作加入隊列，延遲到下一幀執行
-	m_spawnQueue.push_back([this, projectileInfo]() {
+	// 將生成請求加入隊列，延遲到下一幀執行
+	if (m_projectileSpawnQueue.TryPush(projectileInfo)) return;
+
+	std::scoped_lock lock(m_overflowMutex);
+	m_projectileSpawnOverflow.push_back(projectileInfo);
+}
+
+void AttackManager::spawnEffectAttack(const EffectAttackInfo &effectAttackInfo) {
+	// 將生成請求加入隊列，延遲到下一幀執行
+	if (m_effectSpawnQueue.TryPush(effectAttackInfo)) return;
+
+	std::scoped_lock lock(m_overflowMutex);
+	m_effectSpawnOverflow.push_back(effectAttackInfo);
+}
+
+void AttackManager::spawnProjectileBatch(const ProjectileInfo& prototype, const std::vector<AttackShot>& shots)
+{
+	const auto applyShot = [&prototype](ProjectileInfo &info, const AttackShot &shot) {
+		info = prototype;
+		info.attackTransform.translation = shot.position;
+		info.attackTransform.rotation = shot.rotation;
+		info.direction = shot.direction;
+	};
+
+	for (const auto &shot : shots)
+	{
+		if (m_projectileSpawnQueue.TryEmplace([&](ProjectileInfo &slot) { applyShot(slot, shot); })) continue;
+
+		std::scoped_lock lock(m_overflowMutex);
+		applyShot(m_projectileSpawnOverflow.emplace_back(), shot);
+	}
+}
+
+void AttackManager::SpawnProjectileNow(const ProjectileInfo& projectileInfo)
+{
+	// 一般子彈直接寫進SoA陣列，滿了才退回Projectile物件
+	if (BulletSystem::CanSimulate(projectileInfo) && m_bulletSystem.Spawn(projectileInfo))
+	{
+		const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
+		m_bulletSystem.AttachRenderer(currentScene->GetRoot().lock(), currentScene->GetCamera().lock());
+		return;
+	}
+
 	const auto bullet = m_projectilePool.Acquire(projectileInfo);
-	if (bullet == nullptr) {LOG_ERROR("bullet from pool is nullptr!");}
 	bullet->Init(); // 只初始化碰撞組件，不處理渲染
 
 	// 加入渲染樹
@@ -26,12 +70,10 @@ void AttackManager::spawnProjectile(const ProjectileInfo& projectileInfo)
 	const std::shared_ptr<RoomCollisionManager> collisionManager = currentScene->GetCurrentCollisionManager();
 	collisionManager->RegisterNGameObject(bullet);
 	m_projectiles.push_back(bullet);
-	});
 }
 
-void AttackManager::spawnEffectAttack(const EffectAttackInfo &effectAttackInfo) {
-	// 將生成操作加入隊列，延遲到下一幀執行
-	m_spawnQueue.push_back([this, effectAttackInfo]() {
+void AttackManager::SpawnEffectAttackNow(const EffectAttackInfo &effectAttackInfo)
+{
 	auto effectAttack = m_effectPool.Acquire(effectAttackInfo);
 	effectAttack->Init();
 
@@ -45,20 +87,46 @@ void AttackManager::spawnEffectAttack(const EffectAttackInfo &effectAttackInfo)
 	collisionManager->RegisterNGameObject(effectAttack);
 
 	m_effects.push_back(effectAttack);
+}
+
+void AttackManager::ProcessSpawnQueue()
+{
+	// 槽位内的Info會被重複使用，生成後只釋放會延長別人生命週期的指標，字串容量保留給下一發
+	m_projectileSpawnQueue.Drain([this](ProjectileInfo &info) {
+		SpawnProjectileNow(info);
+		info.target.reset();
+		info.chainAttack.nextAttackInfo.reset();
 	});
+	m_effectSpawnQueue.Drain([this](EffectAttackInfo &info) {
+		SpawnEffectAttackNow(info);
+		info.chainAttack.nextAttackInfo.reset();
+	});
+
+	std::vector<ProjectileInfo> projectileOverflow;
+	std::vector<EffectAttackInfo> effectOverflow;
+	{
+		std::scoped_lock lock(m_overflowMutex);
+		projectileOverflow.swap(m_projectileSpawnOverflow);
+		effectOverflow.swap(m_effectSpawnOverflow);
+	}
+	for (const auto &info : projectileOverflow) SpawnProjectileNow(info);
+	for (const auto &info : effectOverflow) SpawnEffectAttackNow(info);
 }
 
 void AttackManager::Update() {
-    if (m_projectiles.empty() && m_projectileRemovalQueue.empty() &&
-		m_effects.empty() && m_effectRemovalQueue.empty() && m_spawnQueue.empty()) return;
+	// 執行所有延遲的 spawn 操作
+	ProcessSpawnQueue();
 
 	const float deltaTime = Util::Time::GetDeltaTimeMs() / 1000.0f;
 
-	// 執行所有延遲的 spawn 操作
-	for (auto& fn : m_spawnQueue) {
-		fn();
+	// SoA子彈：積分 + 碰撞 + 移除
+	if (!m_bulletSystem.Empty())
+	{
+		const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
+		m_bulletSystem.Update(deltaTime, currentScene ? currentScene->GetCurrentCollisionManager() : nullptr);
 	}
-	m_spawnQueue.clear();
+
+    if (m_projectiles.empty() && m_effects.empty()) return;
 
     // 更新子彈與特效
     for (auto& bullet : m_projectiles) {
@@ -68,46 +136,7 @@ void AttackManager::Update() {
         effect->UpdateObject(deltaTime);
     }
 
-    // 處理要移除的子彈
-    {
-        std::vector<std::shared_ptr<Projectile>> activeBullets;
-        activeBullets.reserve(m_projectiles.size());
-
-        for (auto& bullet : m_projectiles) {
-            if (bullet->ShouldRemove()) {
-                bullet->SetActive(false);
-                bullet->SetControlVisible(false);
-                m_projectileRemovalQueue.push_back(bullet);
-            } else {
-                activeBullets.push_back(bullet);
-            }
-        }
-
-        m_projectiles.swap(activeBullets); // 移除掉無效的子彈
-    }
-
-    // 處理要移除的動畫特效
-    {
-        std::vector<std::shared_ptr<EffectAttack>> activeEffects;
-        activeEffects.reserve(m_effects.size());
-
-        for (auto& effect : m_effects) {
-            if (effect->ShouldRemove()) {
-                effect->SetActive(false);
-                effect->SetControlVisible(false);
-                m_effectRemovalQueue.push_back(effect);
-            } else {
-                activeEffects.push_back(effect);
-            }
-        }
-
-        m_effects.swap(activeEffects);
-    }
-
-    // 處理移除隊列（子彈 + 特效）
-    constexpr size_t MAX_PROCESS_PER_FRAME = 8;
-    constexpr int MAX_PROCESS_TIME_US = 1000;
-
+    // 處理要移除的子彈與特效：渲染樹、鏡頭、碰撞管理器都是O(1)移除，當幀直接歸還物件池
     auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
     if (!currentScene) return;
 
@@ -117,37 +146,27 @@ void AttackManager::Update() {
 
     if (!root || !camera || !collisionManager) return;
 
-    auto processStart = std::chrono::high_resolution_clock::now();
-    size_t processedCount = 0;
-
-    while (processedCount < MAX_PROCESS_PER_FRAME && !m_projectileRemovalQueue.empty()) {
-        auto bullet = std::move(m_projectileRemovalQueue.front());
-        m_projectileRemovalQueue.pop_front();
-
-        root->RemoveChild(bullet);
-    	camera->MarkForRemoval(bullet);
-        collisionManager->UnregisterNGameObject(bullet);
-        m_projectilePool.Release(bullet);
-        processedCount++;
-
-        auto now = std::chrono::high_resolution_clock::now();
-        if (std::chrono::duration_cast<std::chrono::microseconds>(now - processStart).count() > MAX_PROCESS_TIME_US)
-            break;
+    const auto detach = [&](const std::shared_ptr<Attack>& attack) {
+        attack->SetActive(false);
+        attack->SetControlVisible(false);
+        root->RemoveChild(attack);
+        camera->MarkForRemoval(attack);
+        collisionManager->UnregisterNGameObject(attack);
+    };
+
+    for (size_t i = 0; i < m_projectiles.size();) {
+        if (!m_projectiles[i]->ShouldRemove()) { ++i; continue; }
+        detach(m_projectiles[i]);
+        m_projectilePool.Release(m_projectiles[i]);
+        m_projectiles[i] = std::move(m_projectiles.back()); // swap-and-pop
+        m_projectiles.pop_back();
     }
 
-    processedCount = 0;
-    while (processedCount < MAX_PROCESS_PER_FRAME && !m_effectRemovalQueue.empty()) {
-        auto effect = std::move(m_effectRemovalQueue.front());
-        m_effectRemovalQueue.pop_front();
-
-        root->RemoveChild(effect);
-    	camera->MarkForRemoval(effect);
-    	collisionManager->UnregisterNGameObject(effect);
-        m_effectPool.Release(effect);
-        processedCount++;
-
-        auto now = std::chrono::high_resolution_clock::now();
-        if (std::chrono::duration_cast<std::chrono::microseconds>(now - processStart).count() > MAX_PROCESS_TIME_US)
-            break;
+    for (size_t i = 0; i < m_effects.size();) {
+        if (!m_effects[i]->ShouldRemove()) { ++i; continue; }
+        detach(m_effects[i]);
+        m_effectPool.Release(m_effects[i]);
+        m_effects[i] = std::move(m_effects.back());
+        m_effects.pop_back();
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,116 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#include "Attack/AttackPoolConfig.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "Attack/BulletSystem.hpp"
+#include "Factory/Factory.hpp"
+#include "Util/Logger.hpp"
+
+namespace
+{
+	constexpr int PLAYER_WEAPON_ID_LIMIT = 500;	  // weapon.json裏500以上是敵人武器
+	constexpr float ENEMY_INSTANCES_PER_TYPE = 3.0f;
+	constexpr float EFFECT_LIFETIME = 0.4f;		  // 斬擊動畫約400ms
+	constexpr float BUBBLES_PER_TRAIL_BULLET = 30.0f; // 每0.2秒左右各一顆、停留3秒
+	constexpr float BOSS_PROJECTILE_RESERVE = 16.0f;  // Boss彈幕（json/bossPattern.json）一般子彈走SoA，只替連鎖子彈保留固定額度
+	constexpr float BOSS_EFFECT_RESERVE = 16.0f;
+	constexpr float HEADROOM = 1.25f;
+
+	struct WeaponDemand
+	{
+		float projectiles = 0.0f; // 需要Projectile物件的數量（特殊子彈）
+		float effects = 0.0f;
+	};
+
+	WeaponDemand CalculateWeaponDemand(const nlohmann::json &weapon)
+	{
+		WeaponDemand demand;
+		const float interval = std::max(weapon.value("attackInterval", 1.0f), 0.01f);
+		const float rate = 1.0f / interval;
+		const bool hasChain = weapon.contains("chainedAttack") && !weapon["chainedAttack"].is_null();
+
+		if (weapon.value("attackType", "") == "Projectile")
+		{
+			const float bullets = static_cast<float>(weapon.value("numOfBullets", 1));
+			const float speed = std::max(weapon.value("bulletSpeed", 400.0f), 1.0f);
+			const float alive = bullets * rate * (BulletSystem::MAX_TRAVEL_DISTANCE / speed);
+
+			const bool special = weapon.value("bulletCanTracking", false) || weapon.value("bulletIsBubble", false) ||
+				weapon.value("bubbleTrail", false) || hasChain;
+			if (special)
+				demand.projectiles += alive;
+			if (weapon.value("bubbleTrail", false))
+				demand.projectiles += alive * BUBBLES_PER_TRAIL_BULLET;
+			if (hasChain)
+				demand.effects += bullets * rate * EFFECT_LIFETIME;
+		}
+		else
+		{
+			demand.effects += std::max(rate * EFFECT_LIFETIME, 1.0f);
+		}
+		return demand;
+	}
+
+	size_t ToTarget(const float demand, const size_t minimum, const size_t maximum)
+	{
+		const auto target = static_cast<size_t>(std::ceil(demand * HEADROOM));
+		return std::clamp(target, minimum, maximum);
+	}
+} // namespace
+
+const AttackPoolConfig &AttackPoolConfig::FromContentConfig()
+{
+	static const AttackPoolConfig config = []
+	{
+		AttackPoolConfig result;
+		const nlohmann::json weaponData = Factory::readJsonFile("weapon.json");
+		const nlohmann::json enemyData = Factory::readJsonFile("enemy.json");
+		if (!weaponData.is_array() || !enemyData.is_array())
+			return result;
+
+		std::unordered_map<int, WeaponDemand> demandById;
+		WeaponDemand player;
+		for (const auto &weapon : weaponData)
+		{
+			const int id = weapon.value("ID", 0);
+			const WeaponDemand demand = CalculateWeaponDemand(weapon);
+			demandById[id] = demand;
+			if (id < PLAYER_WEAPON_ID_LIMIT)
+			{
+				player.projectiles = std::max(player.projectiles, demand.projectiles);
+				player.effects = std::max(player.effects, demand.effects);
+			}
+		}
+
+		WeaponDemand total = player;
+		for (const auto &enemy : enemyData)
+		{
+			if (enemy.value("monsterType", "") == "Boss")
+			{
+				total.projectiles += BOSS_PROJECTILE_RESERVE;
+				total.effects += BOSS_EFFECT_RESERVE;
+				continue;
+			}
+			if (enemy.value("haveWeapon", 0) == 0)
+				continue;
+			if (const auto it = demandById.find(enemy.value("weaponId", 0)); it != demandById.end())
+			{
+				total.projectiles += it->second.projectiles * ENEMY_INSTANCES_PER_TYPE;
+				total.effects += it->second.effects * ENEMY_INSTANCES_PER_TYPE;
+			}
+		}
+
+		result.projectilePrewarm = ToTarget(total.projectiles, 16, 512);
+		result.effectPrewarm = ToTarget(total.effects, 16, 512);
+		result.growStep = std::max<size_t>(result.projectilePrewarm, result.effectPrewarm) / 4;
+		LOG_DEBUG("AttackPool prewarm: projectile={}, effect={}", result.projectilePrewarm, result.effectPrewarm);
+		return result;
+	}();
+	return config;
+}
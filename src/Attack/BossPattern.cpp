@@ -0,0 +1,283 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#include "Attack/BossPattern.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Factory/Factory.hpp"
+#include "Util/Logger.hpp"
+#include "glm/gtc/constants.hpp"
+#include "glm/trigonometric.hpp"
+
+namespace
+{
+	const std::unordered_map<std::string, StatusEffect> STATUS_EFFECTS = {
+		{"NONE", StatusEffect::NONE},		{"BURNS", StatusEffect::BURNS},
+		{"POISON", StatusEffect::POISON},	{"ELECTRIC", StatusEffect::ELECTRIC},
+		{"DIZZINESS", StatusEffect::DIZZINESS}, {"FROZEN", StatusEffect::FROZEN},
+		{"FATIGUE", StatusEffect::FATIGUE}};
+
+	const std::unordered_map<std::string, EffectAttackType> EFFECT_TYPES = {
+		{"SLASH", EffectAttackType::SLASH},
+		{"LUNGE", EffectAttackType::LUNGE},
+		{"SHOCKWAVE", EffectAttackType::SHOCKWAVE},
+		{"LARGE_SHOCKWAVE", EffectAttackType::LARGE_SHOCKWAVE},
+		{"ENERGY_WAVE", EffectAttackType::ENERGY_WAVE},
+		{"LARGE_BOOM", EffectAttackType::LARGE_BOOM},
+		{"MEDIUM_BOOM", EffectAttackType::MEDIUM_BOOM},
+		{"SMALL_BOOM", EffectAttackType::SMALL_BOOM},
+		{"ICE_SPIKE", EffectAttackType::ICE_SPIKE},
+		{"POISON_AREA", EffectAttackType::POISON_AREA}};
+
+	template <typename Enum>
+	Enum Lookup(const std::unordered_map<std::string, Enum> &table, const std::string &key, const Enum fallback)
+	{
+		const auto it = table.find(key);
+		if (it == table.end())
+		{
+			LOG_ERROR("BossPattern: unknown value {}", key);
+			return fallback;
+		}
+		return it->second;
+	}
+
+	glm::vec2 ReadVec2(const nlohmann::json &json, const char *key)
+	{
+		if (!json.contains(key) || !json[key].is_array() || json[key].size() != 2)
+			return glm::vec2(0.0f);
+		return {json[key][0].get<float>(), json[key][1].get<float>()};
+	}
+} // namespace
+
+const BossPatternLibrary &BossPatternLibrary::GetInstance()
+{
+	static const BossPatternLibrary library(Factory::readJsonFile("bossPattern.json"));
+	return library;
+}
+
+BossPatternLibrary::BossPatternLibrary(const nlohmann::json &data)
+{
+	if (!data.is_object() || !data.contains("bullets") || !data.contains("skills"))
+	{
+		LOG_ERROR("BossPattern: bossPattern.json missing or malformed");
+		return;
+	}
+	LoadBullets(data["bullets"]);
+	for (const auto &[name, skillJson] : data["skills"].items())
+		CompileSkill(name, skillJson);
+}
+
+void BossPatternLibrary::LoadBullets(const nlohmann::json &bullets)
+{
+	// 先建立索引，連鎖可以引用寫在後面的樣板
+	for (const auto &[name, json] : bullets.items())
+	{
+		m_BulletIndex[name] = static_cast<uint16_t>(m_Bullets.size());
+		BossBulletTemplate bullet;
+		bullet.offset = ReadVec2(json, "offset");
+		bullet.alignRotation = json.value("alignRotation", false);
+
+		const std::string attackType = json.value("attackType", "Projectile");
+		const int damage = json.value("damage", 0);
+		const float size = json.value("size", 0.0f);
+		const StatusEffect element = Lookup(STATUS_EFFECTS, json.value("elementalDamage", "NONE"), StatusEffect::NONE);
+
+		if (attackType == "Projectile")
+		{
+			bullet.kind = BossBulletTemplate::Kind::PROJECTILE;
+			ProjectileInfo &info = bullet.projectile;
+			info.type = CharacterType::ENEMY;
+			info.size = size;
+			info.damage = damage;
+			info.elementalDamage = element;
+			info.imagePath = std::string(RESOURCE_DIR) + json.value("imagePath", "");
+			info.speed = json.value("speed", 120.0f);
+			info.canReboundBySword = json.value("canReboundBySword", false);
+			info.chainProjectionNum = json.value("chainProjectionNum", 0);
+		}
+		else if (attackType == "EffectAttack")
+		{
+			bullet.kind = BossBulletTemplate::Kind::EFFECT_ATTACK;
+			EffectAttackInfo &info = bullet.effect;
+			info.type = CharacterType::ENEMY;
+			info.size = size;
+			info.damage = damage;
+			info.elementalDamage = element;
+			info.effectType = Lookup(EFFECT_TYPES, json.value("effectType", "SHOCKWAVE"), EffectAttackType::SHOCKWAVE);
+			info.canBlockingBullet = json.value("canBlockingBullet", false);
+			info.canReflectBullet = json.value("canReflectBullet", false);
+			info.continuouslyExtending = json.value("continuouslyExtending", false);
+			info.intervalCreateChainAttack = json.value("intervalCreateChainAttack", 0.0f);
+		}
+		else if (attackType == "Summon")
+		{
+			bullet.kind = BossBulletTemplate::Kind::SUMMON;
+			bullet.summonEnemyId = json.value("enemyId", -1);
+		}
+		else
+		{
+			LOG_ERROR("BossPattern: bullet {} has unknown attackType {}", name, attackType);
+		}
+		m_Bullets.push_back(std::move(bullet));
+	}
+
+	// 連鎖：投射物的連鎖樣板所有子彈共用一份（觸發時只讀取後複製）
+	for (const auto &[name, json] : bullets.items())
+	{
+		if (!json.contains("chain"))
+			continue;
+		BossBulletTemplate &bullet = m_Bullets[m_BulletIndex[name]];
+		const std::string chain = json["chain"].get<std::string>();
+		if (chain == "self" && bullet.kind == BossBulletTemplate::Kind::EFFECT_ATTACK)
+		{
+			bullet.effect.chainAttack.enabled = true;
+			bullet.chainSelf = true;
+			continue;
+		}
+
+		const auto it = m_BulletIndex.find(chain);
+		if (it == m_BulletIndex.end() || bullet.kind != BossBulletTemplate::Kind::PROJECTILE ||
+			m_Bullets[it->second].kind != BossBulletTemplate::Kind::PROJECTILE)
+		{
+			LOG_ERROR("BossPattern: bullet {} has invalid chain {}", name, chain);
+			continue;
+		}
+		bullet.projectile.chainAttack.enabled = true;
+		bullet.projectile.chainAttack.attackType = AttackType::PROJECTILE;
+		bullet.projectile.chainAttack.nextAttackInfo = std::make_shared<ProjectileInfo>(m_Bullets[it->second].projectile);
+	}
+}
+
+void BossPatternLibrary::CompileSkill(const std::string &name, const nlohmann::json &skillJson)
+{
+	BossPatternSkill skill;
+	skill.cooldown = skillJson.value("cooldown", 0.0f);
+	skill.duration = skillJson.value("duration", 0.0f);
+	skill.castTime = skillJson.value("castTime", 0.0f);
+
+	for (const auto &emitter : skillJson.value("emitters", nlohmann::json::array()))
+	{
+		const auto bulletIt = m_BulletIndex.find(emitter.value("bullet", ""));
+		if (bulletIt == m_BulletIndex.end())
+		{
+			LOG_ERROR("BossPattern: skill {} references unknown bullet", name);
+			continue;
+		}
+
+		const std::string shape = emitter.value("shape", "point");
+		const int count = std::max(emitter.value("count", 1), 1);
+		const int repeat = std::max(emitter.value("repeat", 1), 1);
+		const float start = emitter.value("start", 0.0f);
+		const float interval = emitter.value("interval", 0.0f);
+		const float radius = emitter.value("radius", 0.0f);
+		const bool aimAtTarget = emitter.value("aim", "target") == "target";
+		const float baseAngle = glm::radians(emitter.value("angle", 0.0f));
+		const float angularSpeed = glm::radians(emitter.value("angularSpeed", 0.0f)); // 螺旋每秒轉幾度
+
+		for (int round = 0; round < repeat; ++round)
+		{
+			BossPatternEmission emission{};
+			emission.time = start + interval * static_cast<float>(round);
+			emission.bullet = bulletIt->second;
+			emission.firstShot = static_cast<uint16_t>(skill.shots.size());
+			emission.radius = radius;
+			emission.aimAtTarget = aimAtTarget;
+
+			if (shape == "point")
+			{
+				// 原地生成（衝擊波、召喚），沒有方向
+				skill.shots.push_back({glm::vec2(0.0f), 0.0f});
+			}
+			else
+			{
+				float roundAngle = baseAngle;
+				if (shape == "spiral")
+					roundAngle += angularSpeed * emission.time;
+				for (int i = 0; i < count; ++i)
+				{
+					float angle = roundAngle;
+					if (shape == "fan" && count > 1)
+					{
+						const float spread = glm::radians(emitter.value("spread", 0.0f));
+						angle += spread * (static_cast<float>(i) / static_cast<float>(count - 1) - 0.5f);
+					}
+					else if (shape == "ring" || shape == "spiral")
+					{
+						angle += glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(count);
+					}
+					skill.shots.push_back({glm::vec2(std::cos(angle), std::sin(angle)), angle});
+				}
+			}
+			emission.shotCount = static_cast<uint16_t>(skill.shots.size() - emission.firstShot);
+			skill.emissions.push_back(emission);
+		}
+	}
+
+	// 同一時間的項目保留json裏的順序
+	std::stable_sort(skill.emissions.begin(), skill.emissions.end(),
+					 [](const BossPatternEmission &a, const BossPatternEmission &b) { return a.time < b.time; });
+	m_Skills[name] = std::move(skill);
+}
+
+const BossPatternSkill *BossPatternLibrary::FindSkill(const std::string &name) const
+{
+	const auto it = m_Skills.find(name);
+	return it == m_Skills.end() ? nullptr : &it->second;
+}
+
+void BossPatternLibrary::Emit(const BossPatternSkill &skill, const BossPatternEmission &emission,
+							  const glm::vec2 &origin, const glm::vec2 &aimDirection, AttackManager &attackManager,
+							  std::vector<AttackShot> &scratch, const SummonFunc &summon) const
+{
+	const BossBulletTemplate &bullet = m_Bullets[emission.bullet];
+	const glm::vec2 aim = emission.aimAtTarget ? aimDirection : glm::vec2(1.0f, 0.0f);
+	const float aimAngle = emission.aimAtTarget ? std::atan2(aim.y, aim.x) : 0.0f;
+
+	scratch.clear();
+	for (uint16_t i = 0; i < emission.shotCount; ++i)
+	{
+		const BossPatternShot &shot = skill.shots[emission.firstShot + i];
+		// 表裏的方向再轉到目標方向：2x2旋轉，不用三角函數
+		const glm::vec2 direction(shot.direction.x * aim.x - shot.direction.y * aim.y,
+								  shot.direction.x * aim.y + shot.direction.y * aim.x);
+		AttackShot attackShot;
+		attackShot.position = origin + bullet.offset + direction * emission.radius;
+		attackShot.direction = direction;
+		attackShot.rotation = bullet.alignRotation ? shot.angle + aimAngle : 0.0f;
+		scratch.push_back(attackShot);
+	}
+
+	switch (bullet.kind)
+	{
+	case BossBulletTemplate::Kind::PROJECTILE:
+		attackManager.spawnProjectileBatch(bullet.projectile, scratch);
+		break;
+	case BossBulletTemplate::Kind::EFFECT_ATTACK:
+		for (const auto &attackShot : scratch)
+		{
+			EffectAttackInfo info = bullet.effect;
+			info.attackTransform.translation = attackShot.position;
+			info.attackTransform.rotation = attackShot.rotation;
+			info.direction = attackShot.direction;
+			if (bullet.chainSelf)
+			{
+				// 延伸時會改寫連鎖資訊，每一條各自一份
+				auto next = std::make_shared<EffectAttackInfo>(info);
+				info.chainAttack.attackType = AttackType::EFFECT_ATTACK;
+				info.chainAttack.nextAttackInfo = std::move(next);
+			}
+			attackManager.spawnEffectAttack(info);
+		}
+		break;
+	case BossBulletTemplate::Kind::SUMMON:
+		if (summon)
+		{
+			for (const auto &attackShot : scratch)
+				summon(bullet.summonEnemyId, attackShot.position);
+		}
+		break;
+	}
+}
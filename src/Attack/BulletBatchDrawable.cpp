@@ -0,0 +1,165 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#include "Attack/BulletBatchDrawable.hpp"
+
+#include <cmath>
+
+#include "Attack/BulletSystem.hpp"
+#include "Camera.hpp"
+#include "Core/TextureUtils.hpp"
+#include "Util/AssetArchive.hpp"
+#include "Util/Logger.hpp"
+#include "Util/MissingTexture.hpp"
+#include "config.hpp"
+
+BulletBatchDrawable::BulletBatchDrawable(const BulletSystem &system) : m_system(system) {}
+
+BulletBatchDrawable::~BulletBatchDrawable()
+{
+	if (m_indexBuffer != 0)
+		glDeleteBuffers(1, &m_indexBuffer);
+	if (m_vertexBuffer != 0)
+		glDeleteBuffers(1, &m_vertexBuffer);
+	if (m_vertexArray != 0)
+		glDeleteVertexArrays(1, &m_vertexArray);
+}
+
+void BulletBatchDrawable::InitGLResources()
+{
+	m_program = std::make_unique<Core::Program>(PTSD_ASSETS_DIR "/shaders/Base.vert",
+												PTSD_ASSETS_DIR "/shaders/Base.frag");
+	m_program->Bind();
+	const GLint location = glGetUniformLocation(m_program->GetId(), "surface");
+	glUniform1i(location, UNIFORM_SURFACE_LOCATION);
+	m_uniformBuffer = std::make_unique<Core::UniformBuffer<Core::Matrices>>(*m_program, "Matrices", 0);
+
+	glGenVertexArrays(1, &m_vertexArray);
+	glBindVertexArray(m_vertexArray);
+
+	// 頂點交錯存放 (x, y, u, v)，每幀整塊重寫
+	glGenBuffers(1, &m_vertexBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(BulletSystem::MAX_BULLETS * FLOATS_PER_QUAD * sizeof(float)),
+				 nullptr, GL_STREAM_DRAW);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), nullptr);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), reinterpret_cast<void *>(2 * sizeof(float)));
+
+	// 索引固定不變：與Util::Image相同的 0,1,2 / 0,2,3
+	std::vector<GLuint> indices;
+	indices.reserve(BulletSystem::MAX_BULLETS * 6);
+	for (GLuint quad = 0; quad < BulletSystem::MAX_BULLETS; ++quad)
+	{
+		const GLuint base = quad * 4;
+		indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+	}
+	glGenBuffers(1, &m_indexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint)), indices.data(),
+				 GL_STATIC_DRAW);
+
+	glBindVertexArray(0);
+}
+
+uint16_t BulletBatchDrawable::GetTextureIndex(const std::string &imagePath)
+{
+	if (const auto it = m_textureIndices.find(imagePath); it != m_textureIndices.end())
+		return it->second;
+
+	if (m_vertexArray == 0)
+		InitGLResources();
+
+	auto surface = std::shared_ptr<SDL_Surface>(Util::AssetArchive::GetInstance().LoadImageSurface(imagePath),
+												SDL_FreeSurface);
+	if (surface == nullptr)
+	{
+		LOG_ERROR("Failed to load bullet image: '{}'", imagePath);
+		surface = {Util::GetMissingImageTextureSDLSurface(), SDL_FreeSurface};
+	}
+
+	BatchTexture batchTexture;
+	batchTexture.texture = std::make_unique<Core::Texture>(Core::SdlFormatToGlFormat(surface->format->format),
+														   surface->w, surface->h, surface->pixels, false);
+	batchTexture.size = {surface->w, surface->h};
+
+	const auto index = static_cast<uint16_t>(m_textures.size());
+	m_textures.push_back(std::move(batchTexture));
+	m_buckets.emplace_back();
+	m_textureIndices.emplace(imagePath, index);
+	return index;
+}
+
+void BulletBatchDrawable::Draw(const Core::Matrices &data)
+{
+	const size_t count = m_system.m_count;
+	const auto camera = m_camera.lock();
+	if (count == 0 || !camera || m_vertexArray == 0)
+		return;
+
+	// 與Camera::UpdateChildViewportPosition相同：視窗座標 = (世界座標 - 鏡頭座標) * 鏡頭縮放
+	const Util::Transform cameraTransform = camera->GetCameraWorldCoord();
+	const glm::vec2 cameraPos = cameraTransform.translation;
+	const glm::vec2 cameraScale = cameraTransform.scale;
+	const float halfWidth = static_cast<float>(PTSD_Config::WINDOW_WIDTH) * 0.5f;
+	const float halfHeight = static_cast<float>(PTSD_Config::WINDOW_HEIGHT) * 0.5f;
+
+	for (auto &bucket : m_buckets)
+		bucket.clear();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const uint16_t textureIndex = m_system.m_textureIndex[i];
+		const glm::vec2 halfSize =
+			m_textures[textureIndex].size * BulletSystem::PROJECTILE_SCALE * cameraScale * 0.5f;
+		const float centerX = (m_system.m_posX[i] - cameraPos.x) * cameraScale.x;
+		const float centerY = (m_system.m_posY[i] - cameraPos.y) * cameraScale.y;
+
+		// 視窗外的不畫
+		const float radius = std::abs(halfSize.x) + std::abs(halfSize.y);
+		if (std::abs(centerX) - radius > halfWidth || std::abs(centerY) - radius > halfHeight)
+			continue;
+
+		const float c = std::cos(m_system.m_rotation[i]);
+		const float s = std::sin(m_system.m_rotation[i]);
+		const float ax = halfSize.x * c, ay = halfSize.x * s; // 旋轉後的x軸半邊
+		const float bx = -halfSize.y * s, by = halfSize.y * c; // 旋轉後的y軸半邊
+
+		// 左上、左下、右下、右上（UV與Util::Image一致）
+		m_buckets[textureIndex].insert(m_buckets[textureIndex].end(), {
+			centerX - ax + bx, centerY - ay + by, 0.0f, 0.0f,
+			centerX - ax - bx, centerY - ay - by, 0.0f, 1.0f,
+			centerX + ax - bx, centerY + ay - by, 1.0f, 1.0f,
+			centerX + ax + bx, centerY + ay + by, 1.0f, 0.0f,
+		});
+	}
+
+	m_vertices.clear();
+	for (const auto &bucket : m_buckets)
+		m_vertices.insert(m_vertices.end(), bucket.begin(), bucket.end());
+	if (m_vertices.empty())
+		return;
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(m_vertices.size() * sizeof(float)), m_vertices.data());
+
+	m_uniformBuffer->SetData(0, data);
+	m_program->Bind();
+	glBindVertexArray(m_vertexArray);
+
+	size_t firstQuad = 0;
+	for (size_t textureIndex = 0; textureIndex < m_buckets.size(); ++textureIndex)
+	{
+		const size_t quadCount = m_buckets[textureIndex].size() / FLOATS_PER_QUAD;
+		if (quadCount == 0)
+			continue;
+		m_textures[textureIndex].texture->Bind(UNIFORM_SURFACE_LOCATION);
+		glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(quadCount * 6), GL_UNSIGNED_INT,
+					   reinterpret_cast<void *>(firstQuad * 6 * sizeof(GLuint)));
+		firstQuad += quadCount;
+	}
+
+	glBindVertexArray(0);
+}
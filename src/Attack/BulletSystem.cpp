@@ -0,0 +1,394 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#include "Attack/BulletSystem.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Attack/BulletBatchDrawable.hpp"
+#include "Attack/EffectAttack.hpp"
+#include "Camera.hpp"
+#include "Components/CollisionComponent.hpp"
+#include "Components/HealthComponent.hpp"
+#include "Creature/Character.hpp"
+#include "Room/RoomCollisionManager.hpp"
+#include "RoomObject/DestructibleObject.hpp"
+#include "Structs/TakeDamageEventInfo.hpp"
+#include "Util/Renderer.hpp"
+
+namespace
+{
+	constexpr float CELL_SIZE = 32.0f;
+	constexpr float INTERSECT_EPSILON = 0.01f; // 與Rect::Intersects相同的緩衝邊界
+
+	int64_t CellKey(const int cellX, const int cellY)
+	{
+		return (static_cast<int64_t>(cellX) << 32) | static_cast<uint32_t>(cellY);
+	}
+	int ToCell(const float coord) { return static_cast<int>(std::floor(coord / CELL_SIZE)); }
+} // namespace
+
+int BulletSystem::s_nextSourceId = -1;
+
+BulletSystem::BulletSystem() : m_drawable(std::make_shared<BulletBatchDrawable>(*this))
+{
+	// 一次配置到上限，之後生成/移除都不會再配置記憶體
+	for (auto *array : {&m_posX, &m_posY, &m_startX, &m_startY, &m_dirX, &m_dirY, &m_speed, &m_size, &m_rotation})
+		array->resize(MAX_BULLETS);
+	m_damage.resize(MAX_BULLETS);
+	m_element.resize(MAX_BULLETS);
+	m_isCriticalHit.resize(MAX_BULLETS);
+	m_reboundLeft.resize(MAX_BULLETS);
+	m_canReboundBySword.resize(MAX_BULLETS);
+	m_ownerType.resize(MAX_BULLETS);
+	m_layer.resize(MAX_BULLETS);
+	m_mask.resize(MAX_BULLETS);
+	m_textureIndex.resize(MAX_BULLETS);
+	m_sourceId.resize(MAX_BULLETS);
+	m_dead.resize(MAX_BULLETS);
+
+	m_renderHost = std::make_shared<nGameObject>("BulletBatch");
+	m_renderHost->SetDrawable(m_drawable);
+	m_renderHost->SetZIndex(static_cast<float>(ZIndexType::ATTACK) + 10.0f);
+}
+
+BulletSystem::~BulletSystem()
+{
+	if (const auto root = m_renderRoot.lock())
+		root->RemoveChild(m_renderHost);
+}
+
+bool BulletSystem::CanSimulate(const ProjectileInfo &projectileInfo)
+{
+	return !projectileInfo.canTracking && !projectileInfo.isBubble && !projectileInfo.bubbleTrail &&
+		!projectileInfo.chainAttack.enabled;
+}
+
+void BulletSystem::AttachRenderer(const std::shared_ptr<Util::Renderer> &root, const std::shared_ptr<Camera> &camera)
+{
+	m_drawable->SetCamera(camera);
+	if (!root || m_renderRoot.lock() == root)
+		return;
+	if (const auto oldRoot = m_renderRoot.lock())
+		oldRoot->RemoveChild(m_renderHost);
+	root->AddChild(m_renderHost);
+	m_renderRoot = root;
+}
+
+void BulletSystem::SetupCollisionLayer(const CharacterType type, uint8_t &layer, uint8_t &mask)
+{
+	// 與Projectile::Init相同的圖層規則
+	if (type == CharacterType::PLAYER)
+	{
+		layer = CollisionLayers_Player_Projectile;
+		mask = CollisionLayers_Enemy;
+	}
+	else if (type == CharacterType::ENEMY)
+	{
+		layer = CollisionLayers_Enemy_Projectile;
+		mask = CollisionLayers_Player;
+	}
+	else
+	{
+		layer = CollisionLayers_Player_Projectile | CollisionLayers_Enemy_Projectile;
+		mask = CollisionLayers_Player | CollisionLayers_Enemy;
+	}
+	mask |= CollisionLayers_Terrain | CollisionLayers_DestructibleTerrain;
+}
+
+bool BulletSystem::Spawn(const ProjectileInfo &projectileInfo)
+{
+	if (m_count >= MAX_BULLETS)
+		return false;
+
+	const size_t i = m_count++;
+	const glm::vec2 position = projectileInfo.attackTransform.translation;
+	m_posX[i] = m_startX[i] = position.x;
+	m_posY[i] = m_startY[i] = position.y;
+	m_dirX[i] = projectileInfo.direction.x;
+	m_dirY[i] = projectileInfo.direction.y;
+	m_speed[i] = projectileInfo.speed;
+	m_size[i] = projectileInfo.size;
+	m_rotation[i] = projectileInfo.attackTransform.rotation;
+	m_damage[i] = projectileInfo.damage;
+	m_element[i] = projectileInfo.elementalDamage;
+	m_isCriticalHit[i] = projectileInfo.isCriticalHit;
+	m_reboundLeft[i] = projectileInfo.numRebound;
+	m_canReboundBySword[i] = projectileInfo.canReboundBySword;
+	m_ownerType[i] = projectileInfo.type;
+	SetupCollisionLayer(projectileInfo.type, m_layer[i], m_mask[i]);
+	m_textureIndex[i] = m_drawable->GetTextureIndex(projectileInfo.imagePath);
+	m_sourceId[i] = s_nextSourceId;
+	s_nextSourceId = (s_nextSourceId == std::numeric_limits<int>::min()) ? -1 : s_nextSourceId - 1;
+	m_dead[i] = 0;
+	return true;
+}
+
+void BulletSystem::Update(const float deltaTime, const std::shared_ptr<RoomCollisionManager> &collisionManager)
+{
+	if (m_count == 0)
+		return;
+
+	const size_t count = m_count;
+	float *__restrict posX = m_posX.data();
+	float *__restrict posY = m_posY.data();
+	const float *__restrict dirX = m_dirX.data();
+	const float *__restrict dirY = m_dirY.data();
+	const float *__restrict speed = m_speed.data();
+	const float *__restrict startX = m_startX.data();
+	const float *__restrict startY = m_startY.data();
+	uint8_t *__restrict dead = m_dead.data();
+
+	// 積分：沒有分支，編譯器可以直接向量化
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float step = speed[i] * deltaTime;
+		posX[i] += dirX[i] * step;
+		posY[i] += dirY[i] * step;
+	}
+
+	// 射程：離發射點超過MAX_TRAVEL_DISTANCE就消失
+	constexpr float maxDistanceSq = MAX_TRAVEL_DISTANCE * MAX_TRAVEL_DISTANCE;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float dx = posX[i] - startX[i];
+		const float dy = posY[i] - startY[i];
+		dead[i] = static_cast<uint8_t>(dx * dx + dy * dy >= maxDistanceSq);
+	}
+
+	if (collisionManager && collisionManager->IsActive())
+	{
+		uint8_t bulletMasks = 0;
+		for (size_t i = 0; i < count; ++i)
+			bulletMasks |= m_mask[i];
+		BuildColliderSnapshot(collisionManager, bulletMasks);
+		ResolveCollisions();
+	}
+
+	RemoveDeadBullets();
+}
+
+void BulletSystem::BuildColliderSnapshot(const std::shared_ptr<RoomCollisionManager> &collisionManager,
+										 const uint8_t bulletMasks)
+{
+	constexpr uint8_t projectileLayers = CollisionLayers_Player_Projectile | CollisionLayers_Enemy_Projectile;
+
+	m_colliders.clear();
+	m_cellEntries.clear();
+
+	for (const auto &weakObj : collisionManager->GetNGameObjects())
+	{
+		auto obj = weakObj.lock();
+		if (!obj || !obj->IsActive())
+			continue;
+		const auto collider = obj->GetComponent<CollisionComponent>(ComponentType::COLLISION);
+		if (!collider || !collider->IsActive())
+			continue;
+
+		// 只留下子彈打得到、或打得到子彈的物件
+		const uint8_t layer = collider->GetCollisionLayer();
+		const uint8_t mask = collider->GetCollisionMask();
+		if (!(bulletMasks & layer) && !(mask & projectileLayers))
+			continue;
+
+		ColliderSnapshot snapshot{};
+		const Rect bounds = collider->GetBounds();
+		snapshot.left = bounds.left();
+		snapshot.right = bounds.right();
+		snapshot.bottom = bounds.bottom();
+		snapshot.top = bounds.top();
+		snapshot.layer = layer;
+		snapshot.mask = mask;
+		snapshot.isCollider = collider->IsCollider();
+		snapshot.isTrigger = collider->IsTrigger();
+		snapshot.kind = TargetKind::NONE;
+		snapshot.characterType = CharacterType::NEUTRAL;
+		snapshot.response = ProjectileResponse::NONE;
+
+		if (const auto character = std::dynamic_pointer_cast<Character>(obj))
+		{
+			snapshot.kind = TargetKind::CHARACTER;
+			snapshot.characterType = character->GetType();
+		}
+		else if (std::dynamic_pointer_cast<DestructibleObject>(obj))
+		{
+			snapshot.kind = TargetKind::DESTRUCTIBLE;
+		}
+		else if (const auto effect = std::dynamic_pointer_cast<EffectAttack>(obj);
+				 effect && effect->GetAttackLayerType() == CharacterType::PLAYER)
+		{
+			// 玩家斬擊帶有ReflectTriggerStrategy或BlockProjectileStrategy
+			snapshot.response = effect->checkCanReflect() ? ProjectileResponse::REFLECT : ProjectileResponse::BLOCK;
+		}
+		snapshot.hasHealth = snapshot.kind != TargetKind::NONE &&
+			obj->GetComponent<HealthComponent>(ComponentType::HEALTH) != nullptr;
+		snapshot.object = std::move(obj);
+
+		const auto index = static_cast<uint32_t>(m_colliders.size());
+		m_colliders.push_back(std::move(snapshot));
+
+		const ColliderSnapshot &stored = m_colliders.back();
+		for (int cx = ToCell(stored.left); cx <= ToCell(stored.right); ++cx)
+			for (int cy = ToCell(stored.bottom); cy <= ToCell(stored.top); ++cy)
+				m_cellEntries.emplace_back(CellKey(cx, cy), index);
+	}
+
+	std::sort(m_cellEntries.begin(), m_cellEntries.end());
+	if (m_colliderStamp.size() < m_colliders.size())
+		m_colliderStamp.resize(m_colliders.size(), 0);
+	std::fill_n(m_colliderStamp.begin(), m_colliders.size(), 0);
+	m_stamp = 0;
+}
+
+void BulletSystem::ResolveCollisions()
+{
+	if (m_colliders.empty())
+		return;
+
+	for (size_t i = 0; i < m_count; ++i)
+	{
+		if (m_dead[i])
+			continue;
+
+		++m_stamp;
+		bool collisionHandled = false; // 與ProjectileComponent相同：同一幀只處理一次碰撞
+
+		const float half = m_size[i] * 0.5f;
+		const float left = m_posX[i] - half, right = m_posX[i] + half;
+		const float bottom = m_posY[i] - half, top = m_posY[i] + half;
+
+		for (int cx = ToCell(left); cx <= ToCell(right) && !m_dead[i]; ++cx)
+		{
+			for (int cy = ToCell(bottom); cy <= ToCell(top) && !m_dead[i]; ++cy)
+			{
+				const int64_t key = CellKey(cx, cy);
+				auto it = std::lower_bound(m_cellEntries.begin(), m_cellEntries.end(), std::make_pair(key, 0u));
+				for (; it != m_cellEntries.end() && it->first == key && !m_dead[i]; ++it)
+				{
+					const uint32_t colliderIndex = it->second;
+					if (m_colliderStamp[colliderIndex] == m_stamp)
+						continue;
+					m_colliderStamp[colliderIndex] = m_stamp;
+
+					const ColliderSnapshot &other = m_colliders[colliderIndex];
+					const bool bulletHitsOther = m_mask[i] & other.layer;
+					const bool otherHitsBullet = other.mask & m_layer[i];
+					if (!bulletHitsOther && !otherHitsBullet)
+						continue;
+					if (right < other.left + INTERSECT_EPSILON || left > other.right - INTERSECT_EPSILON ||
+						bottom > other.top - INTERSECT_EPSILON || top < other.bottom + INTERSECT_EPSILON)
+						continue;
+
+					// 子彈的扳機：AttackTriggerStrategy
+					if (bulletHitsOther && other.hasHealth)
+					{
+						const TakeDamageEventInfo dmgEvent(m_sourceId[i], m_damage[i], m_element[i],
+														   m_isCriticalHit[i] != 0);
+						other.object->OnEvent(dmgEvent);
+					}
+
+					// 對方的扳機：玩家斬擊反彈/阻擋敵方子彈
+					if (otherHitsBullet && other.isTrigger && other.response != ProjectileResponse::NONE)
+					{
+						if (other.response == ProjectileResponse::REFLECT)
+							ReflectBySword(i);
+						else
+							m_dead[i] = 1;
+						if (m_dead[i])
+							break;
+					}
+
+					// 子彈本身的碰撞：ProjectileComponent::HandleCollision
+					if (!bulletHitsOther || !other.isCollider || collisionHandled)
+						continue;
+					collisionHandled = true;
+
+					const bool hitTarget = other.kind == TargetKind::CHARACTER && other.characterType != m_ownerType[i];
+					if (m_reboundLeft[i] > 0 && !hitTarget)
+					{
+						// 與RoomCollisionManager::CalculateCollisionDetails相同的法綫
+						const float overlapLeft = other.right - left;
+						const float overlapRight = right - other.left;
+						const float overlapTop = top - other.bottom;
+						const float overlapBottom = other.top - bottom;
+						glm::vec2 normal(0.0f);
+						if (std::min(overlapLeft, overlapRight) < std::min(overlapTop, overlapBottom))
+							normal.x = (overlapLeft < overlapRight) ? 1.0f : -1.0f;
+						else
+							normal.y = (overlapTop < overlapBottom) ? -1.0f : 1.0f;
+
+						glm::vec2 direction(m_dirX[i], m_dirY[i]);
+						direction = glm::normalize(direction - 2.0f * glm::dot(direction, normal) * normal);
+						m_dirX[i] = direction.x;
+						m_dirY[i] = direction.y;
+						m_rotation[i] = glm::atan(direction.y, direction.x);
+						--m_reboundLeft[i];
+					}
+					else
+					{
+						m_dead[i] = 1;
+					}
+				}
+			}
+		}
+	}
+
+	// 快照只活一幀，不延長物件的生命週期
+	for (auto &collider : m_colliders)
+		collider.object.reset();
+}
+
+void BulletSystem::ReflectBySword(const size_t index)
+{
+	// 與ProjectileComponent::HandleReflectEvent相同：反向並改成玩家的子彈
+	if (!m_canReboundBySword[index])
+	{
+		m_dead[index] = 1;
+		return;
+	}
+	m_dirX[index] = -m_dirX[index];
+	m_dirY[index] = -m_dirY[index];
+	m_ownerType[index] = CharacterType::PLAYER;
+	m_layer[index] = CollisionLayers_Player_Projectile;
+	m_mask[index] = CollisionLayers_Enemy | CollisionLayers_Terrain;
+}
+
+void BulletSystem::RemoveDeadBullets()
+{
+	// swap-and-pop：把最後一顆搬到空位，順序不重要
+	size_t i = 0;
+	while (i < m_count)
+	{
+		if (!m_dead[i])
+		{
+			++i;
+			continue;
+		}
+		const size_t last = --m_count;
+		if (i == last)
+			break;
+		m_posX[i] = m_posX[last];
+		m_posY[i] = m_posY[last];
+		m_startX[i] = m_startX[last];
+		m_startY[i] = m_startY[last];
+		m_dirX[i] = m_dirX[last];
+		m_dirY[i] = m_dirY[last];
+		m_speed[i] = m_speed[last];
+		m_size[i] = m_size[last];
+		m_rotation[i] = m_rotation[last];
+		m_damage[i] = m_damage[last];
+		m_element[i] = m_element[last];
+		m_isCriticalHit[i] = m_isCriticalHit[last];
+		m_reboundLeft[i] = m_reboundLeft[last];
+		m_canReboundBySword[i] = m_canReboundBySword[last];
+		m_ownerType[i] = m_ownerType[last];
+		m_layer[i] = m_layer[last];
+		m_mask[i] = m_mask[last];
+		m_textureIndex[i] = m_textureIndex[last];
+		m_sourceId[i] = m_sourceId[last];
+		m_dead[i] = m_dead[last];
+	}
+}
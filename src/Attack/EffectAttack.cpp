@@ -30,18 +30,21 @@ void EffectAttack::Init()
 	this->m_WorldCoord = m_Transform.translation;
 
 	// 播放對應的音效
+	static const SFXHandle s_HitFloorSFX = AudioManager::GetInstance().GetSFXHandle("hit_floor_sound");
+	static const SFXHandle s_ExplodeBigSFX = AudioManager::GetInstance().GetSFXHandle("explode_big");
+	static const SFXHandle s_ExplodeSmallSFX = AudioManager::GetInstance().GetSFXHandle("explode_small");
 	switch (m_effectType)
 	{
 	case EffectAttackType::SHOCKWAVE:
 	case EffectAttackType::LARGE_SHOCKWAVE:
-		AudioManager::GetInstance().PlaySFX("hit_floor_sound");
+		AudioManager::GetInstance().PlaySFX(s_HitFloorSFX);
 		break;
 	case EffectAttackType::LARGE_BOOM:
 	case EffectAttackType::MEDIUM_BOOM:
-		AudioManager::GetInstance().PlaySFX("explode_big");
+		AudioManager::GetInstance().PlaySFX(s_ExplodeBigSFX);
 		break;
 	case EffectAttackType::SMALL_BOOM:
-		AudioManager::GetInstance().PlaySFX("explode_small");
+		AudioManager::GetInstance().PlaySFX(s_ExplodeSmallSFX);
 		break;
 	default:
 		break;
@@ -163,6 +166,7 @@ void EffectAttack::ResetAll(const EffectAttackInfo &effectAttackInfo)
 	m_size = effectAttackInfo.size;
 	m_damage = effectAttackInfo.damage;
 	m_elementalDamage = effectAttackInfo.elementalDamage;
+	m_isCriticalHit = effectAttackInfo.isCriticalHit;
 	m_chainAttack = effectAttackInfo.chainAttack;
 
 	m_effectType = effectAttackInfo.effectType;
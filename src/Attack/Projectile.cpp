@@ -7,7 +7,9 @@
 #include <complex>
 
 #include "Attack/AttackManager.hpp"
+#include "Attack/TargetPredictor.hpp"
 #include "Components/CollisionComponent.hpp"
+#include "Components/MovementComponent.hpp"
 #include "Components/ProjectileComponent.hpp"
 #include "Creature/Character.hpp"
 #include "ImagePoolManager.hpp"
@@ -111,22 +113,38 @@ void Projectile::UpdateObject(const float deltaTime)
 	else if (m_canTracking && !m_Target.expired())
 	{
 		// 方法一：追蹤導彈（貝茲曲線）
-		auto targetPosition = m_Target.lock()->GetWorldCoord();
-		glm::vec2 P0 = m_WorldCoord;
-		glm::vec2 P2 = targetPosition;
-
-		m_bezierTime += deltaTime * 0.15f;
-		m_bezierTime = glm::clamp(m_bezierTime, 0.0f, 0.25f);
-		// 控制點P1:
-		// 數值越大： 導彈轉彎越平緩，反應比較慢，感覺像是
-		// 數值越小： 導彈彎得越急促，更快鎖定目標
-		float curveDistance = 100.0f;
-		glm::vec2 P1 = P0 + m_direction * curveDistance;
-
-		glm::vec2 bezierPos = (1 - m_bezierTime) * (1 - m_bezierTime) * P0 +
-			2 * (1 - m_bezierTime) * m_bezierTime * P1 + m_bezierTime * m_bezierTime * P2;
-
-		glm::vec2 newDir = glm::normalize(bezierPos - m_WorldCoord);
+		// 降頻轉向：間隔內累積時間，到期才重算方向；終點取目標的預判攔截點
+		m_steerElapsed += deltaTime;
+		m_steerTimer -= deltaTime;
+		if (m_steerTimer <= 0.0f)
+		{
+			m_steerTimer = std::max(m_steerTimer + TRACKING_STEER_INTERVAL, 0.0f);
+			const auto target = m_Target.lock();
+			glm::vec2 targetVelocity(0.0f);
+			if (const auto moveComp = target->GetComponent<MovementComponent>(ComponentType::MOVEMENT))
+				targetVelocity = moveComp->GetVelocity();
+			glm::vec2 P0 = m_WorldCoord;
+			glm::vec2 P2 = TargetPredictor::PredictIntercept(P0, target->GetWorldCoord(), targetVelocity, m_speed);
+
+			m_bezierTime += m_steerElapsed * 0.15f;
+			m_bezierTime = glm::clamp(m_bezierTime, 0.0f, 0.25f);
+			m_steerElapsed = 0.0f;
+			// 控制點P1:
+			// 數值越大： 導彈轉彎越平緩，反應比較慢，感覺像是
+			// 數值越小： 導彈彎得越急促，更快鎖定目標
+			float curveDistance = 100.0f;
+			glm::vec2 P1 = P0 + m_direction * curveDistance;
+
+			glm::vec2 bezierPos = (1 - m_bezierTime) * (1 - m_bezierTime) * P0 +
+				2 * (1 - m_bezierTime) * m_bezierTime * P1 + m_bezierTime * m_bezierTime * P2;
+
+			if (const glm::vec2 toBezier = bezierPos - m_WorldCoord; glm::length(toBezier) > 0.0001f)
+			{
+				const glm::vec2 newDir = glm::normalize(toBezier);
+				m_direction = newDir;
+				m_Transform.rotation = atan2(newDir.y, newDir.x);
+			}
+		}
 
 		// 方法二：動態尋路法
 		// glm::vec2 toTarget = glm::normalize(targetPosition - m_WorldCoord);
@@ -136,9 +154,6 @@ void Projectile::UpdateObject(const float deltaTime)
 		// float turnRate = curveDistance * deltaTime;
 		// glm::vec2 newDir = glm::normalize(glm::mix(m_direction, toTarget, turnRate));
 
-		m_direction = newDir;
-		m_Transform.rotation = atan2(newDir.y, newDir.x);
-
 		// 移動
 		m_WorldCoord += m_direction * m_speed * deltaTime;
 	}
@@ -204,6 +219,7 @@ void Projectile::ResetAll(const ProjectileInfo &projectileInfo)
 	m_size = projectileInfo.size;
 	m_damage = projectileInfo.damage;
 	m_elementalDamage = projectileInfo.elementalDamage;
+	m_isCriticalHit = projectileInfo.isCriticalHit;
 	m_chainAttack = projectileInfo.chainAttack;
 
 	m_imagePath = projectileInfo.imagePath;
@@ -217,6 +233,8 @@ void Projectile::ResetAll(const ProjectileInfo &projectileInfo)
 	m_bubbleImagePath = projectileInfo.bubbleImagePath;
 
 	m_bezierTime = 0;
+	m_steerTimer = 0.0f;
+	m_steerElapsed = 0.0f;
 	m_reboundCounter = 0;
 	m_markRemove = false;
 	m_bubbleTimer = 0.0f;
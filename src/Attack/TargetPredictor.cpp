@@ -0,0 +1,80 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#include "Attack/TargetPredictor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// 單發與批次共用：a<0（子彈比目標快）時 t = (b + sqrt(b²-4ac)) / (-2a) 是唯一的正根
+	inline float InterceptTime(const float rx, const float ry, const float vx, const float vy, const float speed)
+	{
+		const float a = vx * vx + vy * vy - speed * speed;
+		const float b = 2.0f * (rx * vx + ry * vy);
+		const float c = rx * rx + ry * ry;
+		const bool solvable = a < -1e-4f;
+		const float safeA = solvable ? a : -1.0f;
+		const float discriminant = std::max(b * b - 4.0f * safeA * c, 0.0f);
+		const float time = (b + std::sqrt(discriminant)) / (-2.0f * safeA);
+		return solvable ? std::clamp(time, 0.0f, TargetPredictor::MAX_LEAD_TIME) : 0.0f;
+	}
+} // namespace
+
+glm::vec2 TargetPredictor::PredictIntercept(const glm::vec2 &shooter, const glm::vec2 &target,
+											 const glm::vec2 &targetVelocity, const float projectileSpeed)
+{
+	const float time = InterceptTime(target.x - shooter.x, target.y - shooter.y, targetVelocity.x, targetVelocity.y,
+									 projectileSpeed);
+	return target + targetVelocity * time;
+}
+
+void TargetPredictor::Clear()
+{
+	m_ShooterX.clear();
+	m_ShooterY.clear();
+	m_TargetX.clear();
+	m_TargetY.clear();
+	m_VelocityX.clear();
+	m_VelocityY.clear();
+	m_Speed.clear();
+}
+
+size_t TargetPredictor::Add(const glm::vec2 &shooter, const glm::vec2 &target, const glm::vec2 &targetVelocity,
+							const float projectileSpeed)
+{
+	m_ShooterX.push_back(shooter.x);
+	m_ShooterY.push_back(shooter.y);
+	m_TargetX.push_back(target.x);
+	m_TargetY.push_back(target.y);
+	m_VelocityX.push_back(targetVelocity.x);
+	m_VelocityY.push_back(targetVelocity.y);
+	m_Speed.push_back(projectileSpeed);
+	return m_Speed.size() - 1;
+}
+
+void TargetPredictor::Solve()
+{
+	const size_t count = m_Speed.size();
+	m_AimX.resize(count);
+	m_AimY.resize(count);
+
+	const float *shooterX = m_ShooterX.data();
+	const float *shooterY = m_ShooterY.data();
+	const float *targetX = m_TargetX.data();
+	const float *targetY = m_TargetY.data();
+	const float *velocityX = m_VelocityX.data();
+	const float *velocityY = m_VelocityY.data();
+	const float *speed = m_Speed.data();
+	float *aimX = m_AimX.data();
+	float *aimY = m_AimY.data();
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float time =
+			InterceptTime(targetX[i] - shooterX[i], targetY[i] - shooterY[i], velocityX[i], velocityY[i], speed[i]);
+		aimX[i] = targetX[i] + velocityX[i] * time;
+		aimY[i] = targetY[i] + velocityY[i] * time;
+	}
+}
@@ -15,10 +15,9 @@ Camera::Camera(const std::vector<std::shared_ptr<nGameObject>> &pivotChildren) :
 	m_RandomGenerator(std::random_device{}())
 {
 	// 將 shared_ptr 轉換為 weak_ptr
-	m_Children.reserve(pivotChildren.size());
 	for (const auto &child : pivotChildren)
 	{
-		m_Children.emplace_back(child);
+		m_Children.Add(child);
 	}
 
 	m_CameraWorldCoord.translation = {0.0f, 0.0f};
@@ -92,7 +91,7 @@ void Camera::AddChild(const std::shared_ptr<nGameObject> &child)
 {
 	if (child == nullptr)
 		return;
-	m_Children.emplace_back(child);
+	m_Children.Add(child);
 	// 若為負的會影響物件池内的物件
 	glm::vec2 absScale = {std::abs(child->m_Transform.scale.x), std::abs(child->m_Transform.scale.y)};
 	// 如果尚未設置初始縮放
@@ -105,21 +104,15 @@ void Camera::AddChild(const std::shared_ptr<nGameObject> &child)
 
 void Camera::RemoveChild(const std::shared_ptr<nGameObject> &child)
 {
-	m_Children.erase(std::remove_if(m_Children.begin(), m_Children.end(),
-									[&child](const std::weak_ptr<nGameObject> &weakChild)
-									{
-										auto sharedChild = weakChild.lock();
-										return !sharedChild || sharedChild == child;
-									}),
-					 m_Children.end());
+	// 過期的weak_ptr留給Update順手清掉
+	m_Children.Remove(child.get());
 }
 
 void Camera::AddChildren(const std::vector<std::shared_ptr<nGameObject>> &children)
 {
-	m_Children.reserve(m_Children.size() + children.size());
 	for (const auto &child : children)
 	{
-		m_Children.emplace_back(child);
+		m_Children.Add(child);
 	}
 }
 
@@ -128,12 +121,7 @@ void Camera::MarkForRemoval(const std::shared_ptr<nGameObject> &child) { m_ToRem
 
 bool Camera::FindChild(const std::shared_ptr<nGameObject> &child)
 {
-	return std::find_if(m_Children.begin(), m_Children.end(),
-						[&child](const std::weak_ptr<nGameObject> &weakChild)
-						{
-							auto sharedChild = weakChild.lock();
-							return sharedChild && sharedChild == child;
-						}) != m_Children.end();
+	return m_Children.Contains(child.get());
 }
 
 
@@ -155,30 +143,28 @@ void Camera::Update()
 		m_CameraWorldCoord.translation += m_ShakeOffset;
 	}
 	int i = 0;
-	// 對每個Object調位置
-	for (const auto &weakChild : m_Children)
-	{
-		auto child = weakChild.lock();
-		if (!child)
-			continue;
-		// IsInsideWindow來專門管理是否在視窗内
-		if (NotShouldBeVisible(child))
-		{
-			child->SetIsInsideWindow(false);
-		}
-		else
+	// 對每個Object調位置（已銷毀的順手移除）
+	m_Children.ForEachAlive(
+		[&](const std::shared_ptr<nGameObject> &child)
 		{
-			child->SetIsInsideWindow(true);
-		}
-
-		// 判斷是否顯示
-		child->SetVisible(child->IsInsideWindow() && child->IsControlVisible());
-		if (!child->IsInsideWindow())
-			continue; // 沒顯示就不移動了
-		child->Update();
-		UpdateChildViewportPosition(child);
-		i++;
-	}
+			// IsInsideWindow來專門管理是否在視窗内
+			if (NotShouldBeVisible(child))
+			{
+				child->SetIsInsideWindow(false);
+			}
+			else
+			{
+				child->SetIsInsideWindow(true);
+			}
+
+			// 判斷是否顯示
+			child->SetVisible(child->IsInsideWindow() && child->IsControlVisible());
+			if (!child->IsInsideWindow())
+				return; // 沒顯示就不移動了
+			child->Update();
+			UpdateChildViewportPosition(child);
+			i++;
+		});
 
 	if (count == 100)
 	{
@@ -4,10 +4,13 @@
 
 #include "Components/AiComponent.hpp"
 
+#include <algorithm>
+
 #include "Components/AttackComponent.hpp"
 #include "Components/EnemyAI/AttackStrategy.hpp"
 #include "Components/EnemyAI/MoveStrategy.hpp"
 #include "Components/EnemyAI/UtilityStrategy.hpp"
+#include "Components/FollowerComponent.hpp"
 #include "Components/MovementComponent.hpp"
 #include "Components/StateComponent.hpp"
 #include "Creature/Character.hpp"
@@ -15,13 +18,15 @@
 #include "Scene/SceneManager.hpp"
 #include "ImagePoolManager.hpp"
 #include "Util/Time.hpp"
+#include "Weapon/Weapon.hpp"
 
 AIComponent::AIComponent(const MonsterType MonsterType, const std::shared_ptr<IMoveStrategy> &moveStrategy,
 						 const std::unordered_map<AttackStrategies, std::shared_ptr<IAttackStrategy>> &attackStrategies,
-						 const std::shared_ptr<IUtilityStrategy> &utilityStrategies, const int monsterPoint) :
+						 const std::shared_ptr<IUtilityStrategy> &utilityStrategies, const int monsterPoint,
+						 const BehaviorTree *behaviorTree) :
 	Component(ComponentType::AI), m_aiType(MonsterType), m_moveStrategy(moveStrategy),
 	m_attackStrategy(attackStrategies), m_utilityStrategy(utilityStrategies), m_monsterPoint(monsterPoint),
-	m_enemyState(enemyState::IDLE)
+	m_enemyState(enemyState::IDLE), m_behaviorTree(behaviorTree)
 {
 }
 
@@ -49,10 +54,42 @@ void AIComponent::Init()
 
 
 void AIComponent::Update() {
-	const float deltaTime = Util::Time::GetDeltaTimeMs() / 1000.0f;
 	m_readyAttackIcon->m_WorldCoord = GetOwner<Character>()->GetWorldCoord() + m_iconOffset;
+	if (!m_scheduled)
+	{
+		Think();
+		return;
+	}
+	// 兩次思考之間只沿著上次的決定修正方向
+	if (m_behaviorTree)
+		EnemyMovement::Steer(m_context, m_motion);
+	else if (m_moveStrategy)
+		m_moveStrategy->Steer(m_context);
+}
+
+void AIComponent::Think(const AIPerception *perception) {
+	// 排程器可能隔幾幀才讓這個敵人思考，計時器要用實際經過的時間；
+	// 上限避免剛激活的敵人一次扣掉整段隱藏時間
+	const float now = Util::Time::GetElapsedTimeMs();
+	float deltaTime = Util::Time::GetDeltaTimeMs() / 1000.0f;
+	if (m_lastThinkTimeMs >= 0.0f)
+		deltaTime = std::min((now - m_lastThinkTimeMs) / 1000.0f, 0.25f);
+	m_lastThinkTimeMs = now;
+	m_perception = perception;
+
+	if (m_behaviorTree)
+	{
+		m_motion.steerSpeed = 0.0f;
+		m_behaviorTree->Tick(m_context, m_blackboard, m_motion, deltaTime);
+		m_perception = nullptr;
+		return;
+	}
+
 	if (m_moveStrategy)
+	{
+		m_moveStrategy->ResetSteering();
 		m_moveStrategy->Update(m_context, deltaTime);
+	}
 
 	if (!m_attackStrategy.empty())
 		for(const auto& pair : m_attackStrategy) {
@@ -60,6 +97,7 @@ void AIComponent::Update() {
 		}
 	if (m_utilityStrategy)
 		m_utilityStrategy->Update(m_context);
+	m_perception = nullptr;
 }
 
 void AIComponent::SetEnemyState(const enemyState state)
@@ -100,6 +138,15 @@ void AIComponent::HideReadyAttackIcon()
 	m_readyAttackIcon->SetControlVisible(false);
 }
 
+void AIComponent::ApplyAimPoint() const
+{
+	if (!m_perception || !m_perception->hasAimPoint || !m_context.attackComp)
+		return;
+	if (const auto weapon = m_context.attackComp->GetCurrentWeapon())
+		if (const auto followerComp = weapon->GetComponent<FollowerComponent>(ComponentType::FOLLOWER))
+			followerComp->AimAt(m_perception->aimPoint);
+}
+
 void AIComponent::OnPlayerPositionUpdate(std::weak_ptr<Character> player)
 {
 	m_Target = player;
@@ -139,6 +186,19 @@ void AIComponent::HandleEvent(const EventInfo &eventInfo)
 	if (eventInfo.GetEventType() == EventType::Collision)
 	{
 		const auto& collisionInfo = dynamic_cast<const CollisionEventInfo&>(eventInfo);
-		m_moveStrategy->CollisionAction(collisionInfo, m_context);
+		HandleCollision(collisionInfo);
+	}
+}
+
+void AIComponent::HandleCollision(const CollisionEventInfo &info)
+{
+	if (m_behaviorTree)
+	{
+		float unusedRest = 0.0f;
+		const int restSlot = m_behaviorTree->GetRestSlot();
+		EnemyMovement::CollisionAction(info, m_context, m_motion,
+									   restSlot >= 0 ? m_blackboard.values[restSlot] : unusedRest);
+		return;
 	}
+	m_moveStrategy->CollisionAction(info, m_context);
 }
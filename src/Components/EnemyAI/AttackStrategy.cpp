@@ -6,6 +6,7 @@
 
 #include <glm/gtx/rotate_vector.hpp>
 #include "Attack/AttackManager.hpp"
+#include "Attack/BossPattern.hpp"
 #include "Attack/Projectile.hpp"
 #include "Components/AiComponent.hpp"
 #include "Components/AttackComponent.hpp"
@@ -22,6 +23,8 @@
 bool MeleeAttack::CanAttack(const EnemyContext &ctx)
 {
 	const auto aiComp = ctx.GetAIComp();
+	if (const auto *perception = aiComp->GetPerception(); perception && perception->hasTarget)
+		return perception->targetDistance < m_meleeAttackDistance;
 	if (const auto target = aiComp->GetTarget().lock(); target != nullptr)
 	{
 		const auto distance = glm::distance(target->GetWorldCoord(), ctx.enemy->GetWorldCoord());
@@ -45,6 +48,10 @@ void MeleeAttack::Update(const EnemyContext &ctx, const float deltaTime)
 bool GunAttack::CanAttack(const EnemyContext &ctx)
 {
 	const auto aiComp = ctx.GetAIComp();
+	// 排程器已算好距離與視線：隔著牆不開槍
+	if (const auto *perception = aiComp->GetPerception(); perception && perception->hasTarget)
+		return perception->hasLineOfSight && perception->targetDistance < m_gunAttackDistance &&
+			   perception->targetDistance > m_gunAttackDistance * 0.3f;
 	if (const auto target = aiComp->GetTarget().lock(); target != nullptr)
 	{
 		const auto distance = glm::distance(target->GetWorldCoord(), ctx.enemy->GetWorldCoord());
@@ -58,6 +65,7 @@ void GunAttack::Update(const EnemyContext &ctx, const float deltaTime)
 	if (const auto aiComp = ctx.GetAIComp(); aiComp->GetReadyAttackTimer() <= 0.0f)
 	{
 		aiComp->HideReadyAttackIcon();
+		aiComp->ApplyAimPoint();
 		ctx.attackComp->TryAttack();
 		aiComp->SetEnemyState(
 
@@ -75,6 +83,23 @@ bool CollisionAttack::CanAttack(const EnemyContext &ctx)
 //--------------------------------------------
 // BossAttackStrategy
 //--------------------------------------------
+BossAttackStrategy::BossAttackStrategy()
+{
+	const auto &library = BossPatternLibrary::GetInstance();
+	for (int i = 0; i <= static_cast<int>(BossSkillType::SKILL5); ++i)
+	{
+		const auto type = static_cast<BossSkillType>(i);
+		const BossPatternSkill *pattern = library.FindSkill("SKILL" + std::to_string(i + 1));
+		if (!pattern)
+			LOG_ERROR("BossAttackStrategy: SKILL{} not defined in bossPattern.json", i + 1);
+		patterns[type] = pattern;
+		skills[type] = pattern ? SkillInfo{pattern->cooldown, pattern->duration, pattern->castTime, false, 0.0f, 0}
+							   : SkillInfo{0.0f, 0.0f, 0.0f, false, 0.0f, 0};
+	}
+}
+
+BossAttackStrategy::~BossAttackStrategy() = default;
+
 bool BossAttackStrategy::CanAttack(const EnemyContext &ctx)
 {
 	// Boss的攻擊判斷完全由移動策略控制，這裡只負責執行
@@ -115,296 +140,40 @@ void BossAttackStrategy::Update(const EnemyContext& ctx, const float deltaTime)
 
 void BossAttackStrategy::ExecuteCurrentSkill(const EnemyContext& ctx)
 {
-	switch (currentSkill) {
-		case BossSkillType::SKILL1:
-			ExecuteSkill1(ctx);
-			break;
-		case BossSkillType::SKILL2:
-			ExecuteSkill2(ctx);
-			break;
-		case BossSkillType::SKILL3:
-			ExecuteSkill3(ctx);
-			break;
-		case BossSkillType::SKILL4:
-			ExecuteSkill4(ctx);
-			break;
-		case BossSkillType::SKILL5:
-			ExecuteSkill5(ctx);
-			break;
-	}
-}
-
-void BossAttackStrategy::ExecuteSkill1(const EnemyContext& ctx)
-{
-	auto target = ctx.GetAIComp()->GetTarget().lock();
-	if (!target) return;
-
-	auto& skillInfo = skills[currentSkill];
-
-	// 每 2秒發射一次，共 3 次（duration 通常要 ≥ 1.5 秒）
-	const int totalPhases = 3;
-	const float phaseInterval = 2.0f;
-
-	// 計算這個 phase 應該觸發的時間點（倒數計時）
-	float expectedTriggerTime = skillInfo.duration - skillInfo.currentPhase * phaseInterval;
-
-	// 若已達成該 phase 的觸發時機
-	if (skillInfo.currentPhase < totalPhases && skillInfo.activeTimer <= expectedTriggerTime) {
-		glm::vec2 direction = glm::normalize(target->GetWorldCoord() - ctx.enemy->GetWorldCoord());
-		SpawnLargeSnowball(ctx, direction);
-		skillInfo.currentPhase++;
-	}
-}
-
-void BossAttackStrategy::ExecuteSkill2(const EnemyContext& ctx)
-{
-	auto& skillInfo = skills[currentSkill];
-	const float fireInterval = 0.03f;
-	const float handOffset = 8.0f;
-	const float rotationSpeed = glm::two_pi<float>() / 1.317f;  // 一整圈時間 = 技能持續時間 → 完美形成一個漩渦
-
-	float timeElapsed = skillInfo.duration - skillInfo.activeTimer;
-
-	if (skillInfo.currentPhase < 70 && skillInfo.activeTimer <= skillInfo.duration - skillInfo.castTime - (skillInfo.currentPhase * fireInterval)) {
-
-		// 根據時間旋轉
-		float baseAngle = -timeElapsed * rotationSpeed;
-
-		// 兩隻手在 baseAngle 前後各偏移一個固定角度
-		for (int i = 0; i < 2; ++i) {
-			float offsetAngle = (i == 0) ? 0.0f : glm::pi<float>();  // 左右手相反方向
-			float angle = baseAngle + offsetAngle;
-
-			glm::vec2 direction = glm::vec2(cos(angle), sin(angle));
-			glm::vec2 offset = direction * handOffset;
-			SpawnSmallSnowball(ctx, direction, offset);
-		}
-
-		skillInfo.currentPhase++;
-	}
-}
-
-void BossAttackStrategy::ExecuteSkill3(const EnemyContext& ctx)
-{
-	auto target = ctx.GetAIComp()->GetTarget().lock();
-	if (!target) return;
-
-	auto& skillInfo = skills[currentSkill];
-	// 只發射一次
-	const int numBullets = 6;
-	const float spreadAngle = glm::radians(60.0f);  // 總共散佈的角度
-	const glm::vec2 baseDirection = glm::normalize(target->GetWorldCoord() - ctx.enemy->GetWorldCoord());
-	const float baseRotation = glm::atan(baseDirection.y, baseDirection.x);
-
-	if (skillInfo.currentPhase == 0 && skillInfo.activeTimer <= skillInfo.duration - skillInfo.castTime) {
-		for (int i = 0; i < numBullets; ++i) {
-			float angleOffset = spreadAngle * ((static_cast<float>(i) / (numBullets - 1)) - 0.5f);
-			float newRotation = baseRotation + angleOffset;
-
-			// 以旋轉角度轉回方向向量
-			glm::vec2 newDirection = glm::vec2(cos(newRotation), sin(newRotation));
-			SpawnLongBullet(ctx, newDirection);
-		}
-		skillInfo.currentPhase++;
-	}
-}
-
-void BossAttackStrategy::ExecuteSkill4(const EnemyContext& ctx)
-{
-	auto target = ctx.GetAIComp()->GetTarget().lock();
-	if (!target) return;
-
-	auto& skillInfo = skills[currentSkill];
-	if (skillInfo.currentPhase == 0 && skillInfo.activeTimer <= skillInfo.duration - skillInfo.castTime) {
-		const int numIceSpikes = 5;
-
-		glm::vec2 toTarget = target->GetWorldCoord() - ctx.enemy->GetWorldCoord();
-		glm::vec2 baseDir = glm::normalize(toTarget);
-		float baseAngle = glm::atan(baseDir.y, baseDir.x);  // 基準角：面向玩家
-
-		const float angleStep = glm::radians(360.0f / numIceSpikes);  // 每條冰刺間隔角度
+	const BossPatternSkill *pattern = patterns[currentSkill];
+	if (!pattern) return;
 
-		for (int i = 0; i < numIceSpikes; ++i) {
-			// 從 baseAngle 開始，順時針均分發射
-			float angle = baseAngle + i * angleStep;
-			glm::vec2 direction = glm::vec2(glm::cos(angle), glm::sin(angle));
-			SpawnIceSpike(ctx, direction);
-		}
-		skillInfo.currentPhase++;
-	}
-}
-
-void BossAttackStrategy::ExecuteSkill5(const EnemyContext& ctx)
-{
-	auto target = ctx.GetAIComp()->GetTarget().lock();
-	if (!target) return;
+	const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
+	if (!currentScene) return;
+	const auto attackManager = currentScene->GetManager<AttackManager>(ManagerTypes::ATTACK);
+	if (!attackManager) return;
 
 	auto& skillInfo = skills[currentSkill];
-
-	// 每輪動畫週期
-	const float animationCycle = 0.5833f;
-
-	// 下一階段觸發時間點 = 前搖 + N 個動畫週期
-	float triggerTime = skillInfo.duration - (skillInfo.castTime + animationCycle * skillInfo.currentPhase);
-
-	// 若已到達這個階段應該施放的時間，就觸發
-	if (skillInfo.currentPhase < 5 &&
-		skillInfo.activeTimer <= triggerTime)
+	const float timeElapsed = skillInfo.duration - skillInfo.activeTimer;
+	const glm::vec2 origin = ctx.enemy->GetWorldCoord();
+	const auto target = ctx.GetAIComp()->GetTarget().lock();
+	glm::vec2 aimDirection(1.0f, 0.0f);
+	if (target && glm::length(target->GetWorldCoord() - origin) > 0.001f)
+		aimDirection = glm::normalize(target->GetWorldCoord() - origin);
+
+	const auto summon = [this, &ctx](const int enemyId, const glm::vec2 &position) { SpawnMinion(ctx, enemyId, position); };
+	const auto &library = BossPatternLibrary::GetInstance();
+
+	// 思考間隔較長時一次補發所有到期的項目
+	while (skillInfo.currentPhase < static_cast<int>(pattern->emissions.size()))
 	{
-		SpawnShockwave(ctx);
-		SpawnMiniSnowman(ctx, ctx.enemy->GetWorldCoord());
+		const auto &emission = pattern->emissions[skillInfo.currentPhase];
+		if (emission.time > timeElapsed) break;
+		// 要瞄準的項目等到有目標才發
+		if (emission.aimAtTarget && !target) break;
+		library.Emit(*pattern, emission, origin, aimDirection, *attackManager, shotScratch, summon);
 		skillInfo.currentPhase++;
 	}
 }
 
-void BossAttackStrategy::SpawnLargeSnowball(const EnemyContext& ctx, const glm::vec2& direction)
-{
-	ProjectileInfo largeSnowBall;
-	largeSnowBall.type = CharacterType::ENEMY;
-	largeSnowBall.attackTransform.translation = ctx.enemy->GetWorldCoord();
-	largeSnowBall.attackTransform.rotation = glm::atan(direction.y, direction.x);
-	largeSnowBall.direction = direction;
-	largeSnowBall.size = 16.0f;
-	largeSnowBall.damage = 4;
-	largeSnowBall.elementalDamage = StatusEffect::FROZEN;
-	largeSnowBall.chainAttack.enabled = true;
-	largeSnowBall.imagePath = std::string(RESOURCE_DIR) + "/attackUI/bullet/bullet2/bullet2_3.png";
-	largeSnowBall.speed = 120.0f;
-	largeSnowBall.canReboundBySword = false;
-	largeSnowBall.canTracking = false;
-	largeSnowBall.isBubble = false;
-	largeSnowBall.bubbleTrail = false;
-	largeSnowBall.bubbleImagePath = "";
-	largeSnowBall.chainProjectionNum = 0;
-
-	// 设置连锁攻击的小雪球
-	auto smallSnowBall = std::make_shared<ProjectileInfo>();
-	smallSnowBall->type = CharacterType::ENEMY;
-	smallSnowBall->direction = glm::vec2(0.0f);
-	smallSnowBall->size = 8.0f;
-	smallSnowBall->damage = 2;
-	smallSnowBall->elementalDamage = StatusEffect::FROZEN;
-	smallSnowBall->chainAttack.enabled = false;
-	smallSnowBall->imagePath = std::string(RESOURCE_DIR) + "/attackUI/bullet/bullet_111.png";
-	smallSnowBall->speed = 100.0f;
-	smallSnowBall->canReboundBySword = false;
-	smallSnowBall->canTracking = false;
-	smallSnowBall->isBubble = false;
-	smallSnowBall->bubbleTrail = false;
-	smallSnowBall->bubbleImagePath = "";
-	smallSnowBall->chainProjectionNum = 10;
-
-	largeSnowBall.chainAttack.attackType = AttackType::PROJECTILE;
-	largeSnowBall.chainAttack.nextAttackInfo = smallSnowBall;
-
-	const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
-	const auto attackManager = currentScene->GetManager<AttackManager>(ManagerTypes::ATTACK);
-	attackManager->spawnProjectile(largeSnowBall);
-}
-
-void BossAttackStrategy::SpawnSmallSnowball(const EnemyContext &ctx, const glm::vec2 &direction, const glm::vec2 &offset)
-{
-	ProjectileInfo smallSnowBall;
-	smallSnowBall.type = CharacterType::ENEMY;
-	smallSnowBall.attackTransform.translation = ctx.enemy->GetWorldCoord() + offset;
-	smallSnowBall.direction = direction;
-	smallSnowBall.size = 8.0f;
-	smallSnowBall.damage = 2;
-	smallSnowBall.elementalDamage = StatusEffect::FROZEN;
-	smallSnowBall.chainAttack.enabled = false;
-	smallSnowBall.imagePath = std::string(RESOURCE_DIR) + "/attackUI/bullet/bullet_111.png";
-	smallSnowBall.speed = 120.0f;
-	smallSnowBall.canReboundBySword = false;
-	smallSnowBall.canTracking = false;
-	smallSnowBall.isBubble = false;
-	smallSnowBall.bubbleTrail = false;
-	smallSnowBall.bubbleImagePath = "";
-	smallSnowBall.chainProjectionNum = 0;
-
-	const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
-	const auto attackManager = currentScene->GetManager<AttackManager>(ManagerTypes::ATTACK);
-	attackManager->spawnProjectile(smallSnowBall);
-}
-
-void BossAttackStrategy::SpawnLongBullet(const EnemyContext &ctx, const glm::vec2 &direction)
-{
-	ProjectileInfo longBullet;
-	longBullet.type = CharacterType::ENEMY;
-	longBullet.attackTransform.translation = ctx.enemy->GetWorldCoord() + glm::vec2(0.0f, 8.0f);
-	longBullet.attackTransform.rotation = glm::atan(direction.y, direction.x);
-	longBullet.direction = direction;
-	longBullet.size = 10.0f;
-	longBullet.damage = 3;
-	longBullet.elementalDamage = StatusEffect::NONE;
-	longBullet.chainAttack.enabled = false;
-	longBullet.imagePath = std::string(RESOURCE_DIR) + "/attackUI/bullet/bullet_87.png";
-	longBullet.speed = 180.0f;
-	longBullet.canReboundBySword = true;
-	longBullet.canTracking = false;
-	longBullet.isBubble = false;
-	longBullet.bubbleTrail = false;
-	longBullet.bubbleImagePath = "";
-	longBullet.chainProjectionNum = 0;
-
-	const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
-	const auto attackManager = currentScene->GetManager<AttackManager>(ManagerTypes::ATTACK);
-	attackManager->spawnProjectile(longBullet);
-}
-
-void BossAttackStrategy::SpawnIceSpike(const EnemyContext& ctx, const glm::vec2& direction)
-{
-	EffectAttackInfo iceSpike;
-	iceSpike.type = CharacterType::ENEMY;
-	iceSpike.attackTransform.translation = ctx.enemy->GetWorldCoord() + glm::vec2(0,-20.0f);
-	iceSpike.direction = direction;
-	iceSpike.size = 22.0f;
-	iceSpike.damage = 3;
-	iceSpike.elementalDamage = StatusEffect::FROZEN;
-	iceSpike.chainAttack.enabled = true;
-
-	iceSpike.canBlockingBullet = false;
-	iceSpike.canReflectBullet = false;
-	iceSpike.effectType = EffectAttackType::ICE_SPIKE;
-	iceSpike.continuouslyExtending = true;
-	iceSpike.intervalCreateChainAttack = 0.1f;
-
-	// 淺複製
-	static auto copyAttack = std::make_shared<EffectAttackInfo>();
-	*copyAttack = iceSpike;
-
-	iceSpike.chainAttack.attackType = AttackType::EFFECT_ATTACK;
-	iceSpike.chainAttack.nextAttackInfo = copyAttack;
-
-	const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
-	const auto attackManager = currentScene->GetManager<AttackManager>(ManagerTypes::ATTACK);
-	attackManager->spawnEffectAttack(iceSpike);
-}
-
-void BossAttackStrategy::SpawnShockwave(const EnemyContext& ctx)
-{
-	EffectAttackInfo shockwave;
-	shockwave.type = CharacterType::ENEMY;
-	shockwave.attackTransform.translation = ctx.enemy->GetWorldCoord() + glm::vec2(0,-10.0f);
-	shockwave.attackTransform.rotation = 0;
-	shockwave.direction = glm::vec2(0.0f, 0.0f);
-	shockwave.size = 40.0f;
-	shockwave.damage = 2;
-	shockwave.elementalDamage = StatusEffect::NONE;
-	shockwave.chainAttack.enabled = false;
-
-	shockwave.canBlockingBullet = false;
-	shockwave.canReflectBullet = false;
-	shockwave.effectType = EffectAttackType::LARGE_SHOCKWAVE;
-	shockwave.continuouslyExtending = false;
-
-	const auto currentScene = SceneManager::GetInstance().GetCurrentScene().lock();
-	const auto attackManager = currentScene->GetManager<AttackManager>(ManagerTypes::ATTACK);
-	attackManager->spawnEffectAttack(shockwave);
-}
-
-void BossAttackStrategy::SpawnMiniSnowman(const EnemyContext& ctx, const glm::vec2& position)
+void BossAttackStrategy::SpawnMinion(const EnemyContext& ctx, const int enemyId, const glm::vec2& position)
 {
-	auto enemy = CharacterFactory::GetInstance().createEnemy(21);
+	auto enemy = CharacterFactory::GetInstance().createEnemy(enemyId);
 	if (!enemy)
 	{
 		LOG_ERROR("can't create enemy");
@@ -436,7 +205,7 @@ void BossAttackStrategy::SpawnMiniSnowman(const EnemyContext& ctx, const glm::ve
 		}
 		enemy->SetInitialScale(glm::vec2(0.8f, 0.8f));
 		enemy->SetInitialScaleSet(true);
-		enemy->m_WorldCoord = ctx.enemy->GetWorldCoord() + glm::vec2(0,-15.0f);
+		enemy->m_WorldCoord = position;
 
 		if (auto attackComp = enemy->GetComponent<AttackComponent>(ComponentType::ATTACK))
 		{
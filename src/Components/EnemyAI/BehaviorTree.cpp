@@ -0,0 +1,276 @@
+//
+// Created by tjx20 on 10/19/2026.
+//
+
+#include "Components/EnemyAI/BehaviorTree.hpp"
+
+#include "Components/AiComponent.hpp"
+#include "Components/AttackComponent.hpp"
+#include "Components/EnemyAI/MoveStrategy.hpp"
+#include "Components/MovementComponent.hpp"
+#include "Components/StateComponent.hpp"
+#include "Creature/Character.hpp"
+#include "Factory/Factory.hpp"
+#include "RandomUtil.hpp"
+#include "StructType.hpp"
+#include "Util/Logger.hpp"
+
+namespace
+{
+	const std::unordered_map<std::string, BTNodeType> NODE_TYPES = {
+		{"selector", BTNodeType::SELECTOR},
+		{"sequence", BTNodeType::SEQUENCE},
+		{"invert", BTNodeType::INVERT},
+		{"isState", BTNodeType::IS_STATE},
+		{"hasTarget", BTNodeType::HAS_TARGET},
+		{"inAttackRange", BTNodeType::IN_ATTACK_RANGE},
+		{"isFlag", BTNodeType::IS_FLAG},
+		{"countdown", BTNodeType::COUNTDOWN},
+		{"setValue", BTNodeType::SET_VALUE},
+		{"setTimer", BTNodeType::SET_TIMER},
+		{"setState", BTNodeType::SET_STATE},
+		{"stop", BTNodeType::STOP},
+		{"rest", BTNodeType::REST},
+		{"wander", BTNodeType::WANDER},
+		{"chase", BTNodeType::CHASE},
+		{"keepRange", BTNodeType::KEEP_RANGE},
+		{"readyAttack", BTNodeType::READY_ATTACK},
+		{"charge", BTNodeType::CHARGE},
+		{"attack", BTNodeType::ATTACK}};
+
+	const std::unordered_map<std::string, enemyState> ENEMY_STATES = {
+		{"IDLE", enemyState::IDLE},		   {"WANDERING", enemyState::WANDERING},
+		{"CHASING", enemyState::CHASING}, {"READY_ATTACK", enemyState::READY_ATTACK},
+		{"SKILL1", enemyState::SKILL1},	   {"SKILL2", enemyState::SKILL2},
+		{"SKILL3", enemyState::SKILL3},	   {"SKILL4", enemyState::SKILL4},
+		{"SKILL5", enemyState::SKILL5}};
+} // namespace
+
+//============================= (BehaviorTree) =============================
+BehaviorTree::BehaviorTree(const std::string &name, const nlohmann::json &treeJson) : m_Name(name)
+{
+	if (!treeJson.contains("root"))
+	{
+		LOG_ERROR("BehaviorTree: {} has no root", name);
+		return;
+	}
+	Compile(treeJson["root"]);
+	if (const auto it = m_Slots.find("rest"); it != m_Slots.end())
+		m_RestSlot = it->second;
+	m_Slots.clear();
+}
+
+uint8_t BehaviorTree::Slot(const std::string &key)
+{
+	if (const auto it = m_Slots.find(key); it != m_Slots.end())
+		return it->second;
+	if (m_Slots.size() >= BTBlackboard::MAX_SLOTS)
+	{
+		LOG_ERROR("BehaviorTree: {} uses more than {} blackboard keys", m_Name, BTBlackboard::MAX_SLOTS);
+		return 0;
+	}
+	const auto slot = static_cast<uint8_t>(m_Slots.size());
+	m_Slots.emplace(key, slot);
+	return slot;
+}
+
+void BehaviorTree::Compile(const nlohmann::json &nodeJson)
+{
+	// 前序：先放自己，再放子節點，最後補上子樹結束的位置
+	const size_t index = m_Nodes.size();
+	m_Nodes.emplace_back();
+
+	BTNode node;
+	const std::string type = nodeJson.value("type", "");
+	if (const auto it = NODE_TYPES.find(type); it != NODE_TYPES.end())
+		node.type = it->second;
+	else
+		LOG_ERROR("BehaviorTree: {} has unknown node type {}", m_Name, type);
+
+	if (nodeJson.contains("key"))
+		node.slot = Slot(nodeJson["key"].get<std::string>());
+	if (nodeJson.contains("state"))
+	{
+		const std::string state = nodeJson["state"].get<std::string>();
+		if (const auto it = ENEMY_STATES.find(state); it != ENEMY_STATES.end())
+			node.state = it->second;
+		else
+			LOG_ERROR("BehaviorTree: {} has unknown state {}", m_Name, state);
+	}
+
+	switch (node.type)
+	{
+	case BTNodeType::IN_ATTACK_RANGE:
+		node.a = nodeJson.value("min", 0.0f);
+		node.b = nodeJson.value("max", 0.0f);
+		node.flag = nodeJson.value("lineOfSight", false);
+		break;
+	case BTNodeType::SET_VALUE:
+		node.a = nodeJson.value("value", 0.0f);
+		break;
+	case BTNodeType::SET_TIMER:
+	case BTNodeType::REST:
+		node.a = nodeJson.value("min", 0.0f);
+		node.b = nodeJson.value("max", 0.0f);
+		break;
+	case BTNodeType::WANDER:
+		node.a = nodeJson.value("min", 0.0f);
+		node.b = nodeJson.value("max", 0.0f);
+		node.c = nodeJson.value("speed", 0.2f);
+		break;
+	case BTNodeType::CHASE:
+		node.a = nodeJson.value("distance", 30.0f);
+		node.b = nodeJson.value("speed", 0.2f);
+		node.flag = nodeJson.value("faceTarget", true);
+		break;
+	case BTNodeType::KEEP_RANGE:
+		node.a = nodeJson.value("range", 200.0f);
+		break;
+	case BTNodeType::ATTACK:
+		node.flag = nodeJson.value("stop", false);
+		break;
+	default:
+		break;
+	}
+	m_Nodes[index] = node;
+
+	const auto children = nodeJson.value("children", nlohmann::json::array());
+	for (const auto &child : children)
+		Compile(child);
+	if (node.type == BTNodeType::INVERT && children.size() != 1)
+		LOG_ERROR("BehaviorTree: {} invert node needs exactly one child", m_Name);
+	m_Nodes[index].end = static_cast<uint16_t>(m_Nodes.size());
+}
+
+void BehaviorTree::Tick(const EnemyContext &ctx, BTBlackboard &blackboard, EnemyMotion &motion,
+						const float deltaTime) const
+{
+	if (!m_Nodes.empty())
+		Run(0, ctx, blackboard, motion, deltaTime);
+}
+
+BTStatus BehaviorTree::Run(const uint16_t index, const EnemyContext &ctx, BTBlackboard &blackboard,
+						   EnemyMotion &motion, const float deltaTime) const
+{
+	const BTNode &node = m_Nodes[index];
+	float &value = blackboard.values[node.slot];
+	const auto result = [](const bool success) { return success ? BTStatus::SUCCESS : BTStatus::FAILURE; };
+
+	switch (node.type)
+	{
+	case BTNodeType::SELECTOR:
+		for (uint16_t child = index + 1; child < node.end; child = m_Nodes[child].end)
+			if (Run(child, ctx, blackboard, motion, deltaTime) == BTStatus::SUCCESS)
+				return BTStatus::SUCCESS;
+		return BTStatus::FAILURE;
+	case BTNodeType::SEQUENCE:
+		for (uint16_t child = index + 1; child < node.end; child = m_Nodes[child].end)
+			if (Run(child, ctx, blackboard, motion, deltaTime) == BTStatus::FAILURE)
+				return BTStatus::FAILURE;
+		return BTStatus::SUCCESS;
+	case BTNodeType::INVERT:
+		if (index + 1 >= node.end)
+			return BTStatus::FAILURE;
+		return result(Run(index + 1, ctx, blackboard, motion, deltaTime) == BTStatus::FAILURE);
+
+	case BTNodeType::IS_STATE:
+		return result(ctx.GetAIComp()->GetEnemyState() == node.state);
+	case BTNodeType::HAS_TARGET:
+		return result(!ctx.GetAIComp()->GetTarget().expired());
+	case BTNodeType::IN_ATTACK_RANGE:
+	{
+		const auto aiComp = ctx.GetAIComp();
+		// 排程器已算好距離與視線
+		if (const auto *perception = aiComp->GetPerception(); perception && perception->hasTarget)
+			return result((!node.flag || perception->hasLineOfSight) && perception->targetDistance >= node.a &&
+						  perception->targetDistance < node.b);
+		if (const auto target = aiComp->GetTarget().lock())
+		{
+			const float distance = glm::distance(target->GetWorldCoord(), ctx.enemy->GetWorldCoord());
+			return result(distance >= node.a && distance < node.b);
+		}
+		return BTStatus::FAILURE;
+	}
+	case BTNodeType::IS_FLAG:
+		return result(value != 0.0f);
+
+	case BTNodeType::COUNTDOWN:
+		value -= deltaTime;
+		return result(value <= 0.0f);
+	case BTNodeType::SET_VALUE:
+		value = node.a;
+		return BTStatus::SUCCESS;
+	case BTNodeType::SET_TIMER:
+		value = RandomUtil::RandomFloatInRange(node.a, node.b);
+		return BTStatus::SUCCESS;
+	case BTNodeType::SET_STATE:
+		ctx.GetAIComp()->SetEnemyState(node.state);
+		return BTStatus::SUCCESS;
+	case BTNodeType::STOP:
+		ctx.moveComp->SetDesiredDirection(glm::vec2(0.0f));
+		ctx.stateComp->SetState(State::STANDING);
+		return BTStatus::SUCCESS;
+	case BTNodeType::REST:
+		value = EnemyMovement::ChangeToIdle(ctx, node.a, node.b);
+		return BTStatus::SUCCESS;
+	case BTNodeType::WANDER:
+		value = EnemyMovement::EnterWanderState(ctx, node.a, node.b, node.c);
+		return BTStatus::SUCCESS;
+	case BTNodeType::CHASE:
+		EnemyMovement::MaintainDistanceMove(ctx, motion, node.a, node.b, node.flag);
+		return BTStatus::SUCCESS;
+	case BTNodeType::KEEP_RANGE:
+		EnemyMovement::MaintainRangeForGun(ctx, motion, node.a);
+		return BTStatus::SUCCESS;
+	case BTNodeType::READY_ATTACK:
+	{
+		const auto aiComp = ctx.GetAIComp();
+		aiComp->ShowReadyAttackIcon();
+		aiComp->SetEnemyState(enemyState::READY_ATTACK);
+		return BTStatus::SUCCESS;
+	}
+	case BTNodeType::CHARGE:
+	{
+		const auto aiComp = ctx.GetAIComp();
+		aiComp->DeductionReadyAttackTimer(deltaTime);
+		return result(aiComp->GetReadyAttackTimer() <= 0.0f);
+	}
+	case BTNodeType::ATTACK:
+	{
+		const auto aiComp = ctx.GetAIComp();
+		aiComp->HideReadyAttackIcon();
+		aiComp->ApplyAimPoint();
+		ctx.attackComp->TryAttack();
+		aiComp->SetEnemyState(enemyState::IDLE);
+		if (node.flag)
+			ctx.moveComp->SetDesiredDirection(glm::vec2(0.0f));
+		aiComp->ResetReadyAttackTimer();
+		return BTStatus::SUCCESS;
+	}
+	}
+	return BTStatus::FAILURE;
+}
+
+//============================= (BehaviorTreeLibrary) =============================
+const BehaviorTreeLibrary &BehaviorTreeLibrary::GetInstance()
+{
+	static const BehaviorTreeLibrary library(Factory::readJsonFile("enemyBehavior.json"));
+	return library;
+}
+
+BehaviorTreeLibrary::BehaviorTreeLibrary(const nlohmann::json &data)
+{
+	if (!data.is_object())
+	{
+		LOG_ERROR("BehaviorTree: enemyBehavior.json missing or malformed");
+		return;
+	}
+	for (const auto &[name, treeJson] : data.items())
+		m_Trees.try_emplace(name, name, treeJson);
+}
+
+const BehaviorTree *BehaviorTreeLibrary::Find(const std::string &name) const
+{
+	const auto it = m_Trees.find(name);
+	return it == m_Trees.end() ? nullptr : &it->second;
+}
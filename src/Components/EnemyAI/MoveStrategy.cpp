@@ -7,12 +7,14 @@
 #include "Components/MovementComponent.hpp"
 #include "Creature/Character.hpp"
 #include "Override/nGameObject.hpp"
+#include "Room/DungeonRoom.hpp"
+#include "Scene/SceneManager.hpp"
 #include "StructType.hpp"
 #include "RandomUtil.hpp"
 #include "Util/Time.hpp"
 
-//============================= (Base) =============================
-void IMoveStrategy::ReflectMovement(const CollisionEventInfo &info, const EnemyContext &ctx)
+//============================= (EnemyMovement) =============================
+void EnemyMovement::ReflectMovement(const CollisionEventInfo &info, const EnemyContext &ctx)
 {
 	glm::vec2 oldDir = glm::normalize(ctx.moveComp->GetLastValidDirection());
 	glm::vec2 reflectDir = glm::reflect(oldDir, info.GetCollisionNormal());
@@ -27,8 +29,25 @@ void IMoveStrategy::ReflectMovement(const CollisionEventInfo &info, const EnemyC
 	ctx.moveComp->SetDesiredDirection(reflectDir);
 }
 
-void IMoveStrategy::CollisionAction(const CollisionEventInfo &info, const EnemyContext &ctx)
+void EnemyMovement::Steer(const EnemyContext &ctx, EnemyMotion &motion)
+{
+	if (motion.steerSpeed <= 0.0f)
+		return;
+	const auto target = ctx.GetAIComp()->GetTarget().lock();
+	if (!target)
+	{
+		motion.steerSpeed = 0.0f;
+		return;
+	}
+	ctx.moveComp->SetDesiredDirection(DirectionToward(ctx, motion, target->GetWorldCoord()) * motion.steerSpeed);
+}
+
+void EnemyMovement::CollisionAction(const CollisionEventInfo &info, const EnemyContext &ctx, EnemyMotion &motion,
+									float &restTimer)
 {
+	// 碰撞反應優先，下一次思考前不再逐幀修正方向
+	motion.steerSpeed = 0.0f;
+
 	// ememy與玩家碰撞后:
 	// 攻擊模式：反彈繼續走
 	// 其他模式：强制進入閑置狀態
@@ -41,7 +60,7 @@ void IMoveStrategy::CollisionAction(const CollisionEventInfo &info, const EnemyC
 			} else {
 				aiComp->SetEnemyState(enemyState::IDLE);
 				ctx.moveComp->SetDesiredDirection(glm::vec2(0,0));
-				m_restTimer = RandomUtil::RandomFloatInRange(0.3f, 1.0f); // 設定休息時間
+				restTimer = RandomUtil::RandomFloatInRange(0.3f, 1.0f); // 設定休息時間
 			}
 		}
 	}
@@ -52,30 +71,45 @@ void IMoveStrategy::CollisionAction(const CollisionEventInfo &info, const EnemyC
 		ReflectMovement(info, ctx);
 }
 
-void IMoveStrategy::EnterWanderState(const EnemyContext &ctx, float minTime, float maxTime, float moveRatio) {
+float EnemyMovement::EnterWanderState(const EnemyContext &ctx, float minTime, float maxTime, float moveRatio) {
 	glm::vec2 deltaDir = glm::normalize(RandomUtil::RandomDirectionInsideUnitCircle()) * moveRatio;
 	ctx.moveComp->SetDesiredDirection(deltaDir);
-	// 設定移動持續時間
-	m_moveTimer = RandomUtil::RandomFloatInRange(minTime, maxTime);
 	ctx.GetAIComp()->SetEnemyState(enemyState::WANDERING);
+	// 移動持續時間
+	return RandomUtil::RandomFloatInRange(minTime, maxTime);
 }
 
-void IMoveStrategy::RestIfNeeded(float deltaTime, const EnemyContext &ctx, float minTime, float maxTime) {
-	m_restTimer -= deltaTime;
-	if (m_restTimer <= 0.f) {
-		EnterWanderState(ctx, minTime, maxTime);
-	}
-}
-
-void IMoveStrategy::changeToIdle(const EnemyContext &ctx, float minTime, float maxTime) {
-	const auto aiComp = ctx.GetAIComp();
+float EnemyMovement::ChangeToIdle(const EnemyContext &ctx, float minTime, float maxTime) {
 	// 移動結束，開始休息
 	ctx.moveComp->SetDesiredDirection(glm::vec2(0, 0)); // 停止移動
-	m_restTimer = RandomUtil::RandomFloatInRange(minTime, maxTime); // 設定休息時間
-	aiComp->SetEnemyState(enemyState::IDLE);
+	ctx.GetAIComp()->SetEnemyState(enemyState::IDLE);
+	return RandomUtil::RandomFloatInRange(minTime, maxTime); // 休息時間
 }
 
-void IMoveStrategy::MaintainDistanceMove(const EnemyContext& ctx, float optimalDistance, float speed, bool faceToTarget)
+glm::vec2 EnemyMovement::DirectionToward(const EnemyContext &ctx, EnemyMotion &motion, const glm::vec2 &targetPos)
+{
+	// 思考期間優先用排程器平行階段算好的流場方向
+	if (const auto *perception = ctx.GetAIComp()->GetPerception();
+		perception && perception->hasFlowDirection && perception->targetPos == targetPos)
+		return perception->flowDirection;
+
+	const glm::vec2 position = ctx.enemy->GetWorldCoord();
+	if (const auto scene = SceneManager::GetInstance().GetCurrentScene().lock())
+	{
+		if (const auto room = std::dynamic_pointer_cast<DungeonRoom>(scene->GetCurrentRoom()))
+		{
+			// 目標是玩家時直接取樣房間共用流場，O(1)
+			if (glm::vec2 direction; room->GetFlowField().Sample(position, targetPos, direction))
+				return direction;
+			return motion.pathFollower.Steer(*room->GetPathfinder(), position, targetPos);
+		}
+	}
+	// 不在地牢房間（沒有網格）就直線走
+	return glm::normalize(targetPos - position);
+}
+
+void EnemyMovement::MaintainDistanceMove(const EnemyContext &ctx, EnemyMotion &motion, float optimalDistance,
+										 float speed, bool faceToTarget)
 {
 	// 維持距離移動
 	auto target = ctx.GetAIComp()->GetTarget().lock();
@@ -89,9 +123,10 @@ void IMoveStrategy::MaintainDistanceMove(const EnemyContext& ctx, float optimalD
 		direction = glm::normalize(ctx.enemy->GetWorldCoord() - target->GetWorldCoord());
 		ctx.moveComp->SetDesiredDirection(direction * speed);
 	} else if (currentDistance > optimalDistance * 1.2f) {
-		// 太遠了，前進
-		direction = glm::normalize(target->GetWorldCoord() - ctx.enemy->GetWorldCoord());
+		// 太遠了，前進（被擋住就繞路）
+		direction = DirectionToward(ctx, motion, target->GetWorldCoord());
 		ctx.moveComp->SetDesiredDirection(direction * speed);
+		motion.steerSpeed = speed;
 	} else {
 		// 在最佳距離，停止移動
 		ctx.moveComp->SetDesiredDirection(glm::vec2(0.0f));
@@ -109,7 +144,7 @@ void IMoveStrategy::MaintainDistanceMove(const EnemyContext& ctx, float optimalD
 	}
 }
 
-void IMoveStrategy::MaintainCircleMove(const EnemyContext& ctx, float circleRadius, float speed)
+void EnemyMovement::MaintainCircleMove(const EnemyContext &ctx, EnemyMotion &motion, float circleRadius, float speed)
 {
 	// 繞圈
 	const auto target = ctx.GetAIComp()->GetTarget().lock();
@@ -125,8 +160,8 @@ void IMoveStrategy::MaintainCircleMove(const EnemyContext& ctx, float circleRadi
 		glm::vec2 outward = glm::normalize(ctx.enemy->GetWorldCoord() - target->GetWorldCoord());
 		ctx.moveComp->SetDesiredDirection((outward + tangent) * speed);
 	} else if (currentDistance > circleRadius * 1.2f) {
-		// 太遠了，向內移動
-		glm::vec2 inward = glm::normalize(toTarget);
+		// 太遠了，向內移動（被擋住就繞路）
+		glm::vec2 inward = DirectionToward(ctx, motion, target->GetWorldCoord());
 		ctx.moveComp->SetDesiredDirection((inward + tangent) * speed);
 	} else {
 		// 在正確距離，繞圈
@@ -134,6 +169,56 @@ void IMoveStrategy::MaintainCircleMove(const EnemyContext& ctx, float circleRadi
 	}
 }
 
+void EnemyMovement::MaintainRangeForGun(const EnemyContext &ctx, EnemyMotion &motion, const float attackDistance)
+{
+	const auto target = ctx.GetAIComp()->GetTarget().lock();
+	if (!target) return;
+
+	const float optimalDistance = attackDistance * 0.8f; // 80% 的最大射程是最佳射击距离
+	const float minDistance = attackDistance * 0.4f;     // 最小保持距离
+
+	const glm::vec2 enemyPosition = ctx.enemy->GetWorldCoord();
+	const glm::vec2 targetPosition = target->GetWorldCoord();
+	const float currentDistance = glm::distance(enemyPosition, targetPosition);
+
+	glm::vec2 directionVector = glm::vec2(0, 0);
+
+	if (currentDistance < minDistance) {
+		// 太近了，需要后退
+		directionVector = glm::normalize(enemyPosition - targetPosition) * 0.3f; // 后退速度稍快
+	} else if (currentDistance < optimalDistance * 0.9f) {
+		// 接近最佳距离但仍然有点近，慢慢后退
+		directionVector = glm::normalize(enemyPosition - targetPosition) * 0.15f;
+	} else if (currentDistance > optimalDistance * 1.1f) {
+		// 太远了，需要接近（被擋住就繞路）
+		directionVector = DirectionToward(ctx, motion, targetPosition) * 0.2f;
+		motion.steerSpeed = 0.2f;
+	} else {
+		// 在最佳射击范围内，只需停下来瞄准
+		directionVector = glm::vec2(0, 0);
+		ctx.stateComp->SetState(State::STANDING);
+	}
+
+	ctx.moveComp->SetDesiredDirection(directionVector);
+}
+
+//============================= (Base) =============================
+void IMoveStrategy::EnterWanderState(const EnemyContext &ctx, float minTime, float maxTime, float moveRatio) {
+	// 設定移動持續時間
+	m_moveTimer = EnemyMovement::EnterWanderState(ctx, minTime, maxTime, moveRatio);
+}
+
+void IMoveStrategy::RestIfNeeded(float deltaTime, const EnemyContext &ctx, float minTime, float maxTime) {
+	m_restTimer -= deltaTime;
+	if (m_restTimer <= 0.f) {
+		EnterWanderState(ctx, minTime, maxTime);
+	}
+}
+
+void IMoveStrategy::changeToIdle(const EnemyContext &ctx, float minTime, float maxTime) {
+	m_restTimer = EnemyMovement::ChangeToIdle(ctx, minTime, maxTime); // 設定休息時間
+}
+
 void IMoveStrategy::MaintainStrafeMove(const EnemyContext& ctx, float optimalDistance, float deltaTime, float speed)
 {
 	// 左右擺動==>蛇行
@@ -225,7 +310,7 @@ void ChaseMove::Update(const EnemyContext &ctx, const float deltaTime) {
 					MaintainOptimalRangeForGun(ctx, target, gun);
 				} else {
 					// 純近戰敵人正常追逐玩家
-					MaintainDistanceMove(ctx, 30.0f, 0.2f, true);
+					EnemyMovement::MaintainDistanceMove(ctx, m_motion, 30.0f, 0.2f, true);
 				}
 
 				checkAttackCondition(ctx);
@@ -242,7 +327,7 @@ void ChaseMove::Update(const EnemyContext &ctx, const float deltaTime) {
 				if (const auto target = ctx.GetAIComp()->GetTarget().lock(); target != nullptr) {
 					if (const auto attack = aiComp->GetAttackStrategy(AttackStrategies::MELEE)) {
 						// 繼續追蹤玩家
-						MaintainDistanceMove(ctx, 30.0f, 0.2f, true);
+						EnemyMovement::MaintainDistanceMove(ctx, m_motion, 30.0f, 0.2f, true);
 					}
 					else if (const auto gun = aiComp->GetAttackStrategy(AttackStrategies::GUN)) {
 						// 停止並瞄準
@@ -262,33 +347,9 @@ void ChaseMove::Update(const EnemyContext &ctx, const float deltaTime) {
 
 
 void ChaseMove::MaintainOptimalRangeForGun(const EnemyContext &ctx, std::shared_ptr<nGameObject> target,
-										  const std::shared_ptr<IAttackStrategy>& gunStrategy) const
+										  const std::shared_ptr<IAttackStrategy>& gunStrategy)
 {
-	const float optimalDistance = gunStrategy->GetAttackDistance() * 0.8f; // 80% 的最大射程是最佳射击距离
-	const float minDistance = gunStrategy->GetAttackDistance() * 0.4f;     // 最小保持距离
-
-	const glm::vec2 enemyPosition = ctx.enemy->GetWorldCoord();
-	const glm::vec2 targetPosition = target->GetWorldCoord();
-	const float currentDistance = glm::distance(enemyPosition, targetPosition);
-
-	glm::vec2 directionVector = glm::vec2(0, 0);
-
-	if (currentDistance < minDistance) {
-		// 太近了，需要后退
-		directionVector = glm::normalize(enemyPosition - targetPosition) * 0.3f; // 后退速度稍快
-	} else if (currentDistance < optimalDistance * 0.9f) {
-		// 接近最佳距离但仍然有点近，慢慢后退
-		directionVector = glm::normalize(enemyPosition - targetPosition) * 0.15f;
-	} else if (currentDistance > optimalDistance * 1.1f) {
-		// 太远了，需要接近
-		directionVector = glm::normalize(targetPosition - enemyPosition) * 0.2f;
-	} else {
-		// 在最佳射击范围内，只需停下来瞄准
-		directionVector = glm::vec2(0, 0);
-		ctx.stateComp->SetState(State::STANDING);
-	}
-
-	ctx.moveComp->SetDesiredDirection(directionVector);
+	EnemyMovement::MaintainRangeForGun(ctx, m_motion, gunStrategy->GetAttackDistance());
 }
 
 void ChaseMove::checkAttackCondition(const EnemyContext &ctx) const
@@ -409,20 +470,20 @@ void BossMove::UpdateSkillState(const EnemyContext &ctx, float deltaTime)
 
 void BossMove::UpdateSkill1MoveState(const EnemyContext &ctx, float deltaTime)
 {
-	MaintainDistanceMove(ctx, 150.0f, 0.3f, true);
+	EnemyMovement::MaintainDistanceMove(ctx, m_motion, 150.0f, 0.3f, true);
 }
 
 void BossMove::UpdateSkill2MoveState(const EnemyContext &ctx, float deltaTime)
 {
 	// 繞著玩家轉圈
-	MaintainCircleMove(ctx, 100.0f, 0.2f);
+	EnemyMovement::MaintainCircleMove(ctx, m_motion, 100.0f, 0.2f);
 	ctx.enemy->m_Transform.scale.x = std::abs(ctx.enemy->m_Transform.scale.x);
 }
 
 void BossMove::UpdateSkill3MoveState(const EnemyContext &ctx, float deltaTime)
 {
 	// 保持中等距離
-	MaintainDistanceMove(ctx, 150.0f, 0.2f, true);
+	EnemyMovement::MaintainDistanceMove(ctx, m_motion, 150.0f, 0.2f, true);
 }
 
 void BossMove::UpdateSkill4MoveState(const EnemyContext &ctx, float deltaTime)
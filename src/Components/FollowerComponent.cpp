@@ -67,6 +67,16 @@ void FollowerComponent::BaseTargetRotate() {
 	m_baseRotation = m_HoldingRotation;
 }
 
+void FollowerComponent::AimAt(const glm::vec2 &worldPoint) {
+	const auto owner = GetOwner<nGameObject>();
+	if (!owner) return;
+	const glm::vec2 direction = worldPoint - owner->m_WorldCoord;
+	if (glm::length(direction) < 0.01f) return;
+	m_HoldingRotation = std::atan2(direction.y, direction.x);
+	m_baseRotation = m_HoldingRotation;
+	owner->m_Transform.rotation = m_HoldingRotation;
+}
+
 void FollowerComponent::Update() {
 	const auto owner = GetOwner<nGameObject>();
 
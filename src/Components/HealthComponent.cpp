@@ -77,40 +77,7 @@ void HealthComponent::HandleEvent(const EventInfo &eventInfo)
 	case EventType::TakeDamage:
 		{
 			const auto &dmgInfo = dynamic_cast<const TakeDamageEventInfo &>(eventInfo);
-			const auto ObjectID = dmgInfo.m_Id;
-			// 冷卻中就不處理
-			if (m_recentAttackSources.count(ObjectID) > 0)
-				break;
-			m_recentAttackSources[ObjectID] = m_invincibleDuration;
-
-			// 如果是暴擊，播放暴擊音效
-			if (dmgInfo.isCriticalHit)
-			{
-				AudioManager::GetInstance().PlaySFX("critical_hit");
-			}
-
-			TakeDamage(dmgInfo.damage);
-
-			const auto owner = GetOwner<nGameObject>();
-			if (!owner)
-				return;
-			// 元素傷害
-			if (dmgInfo.elementalDamage != StatusEffect::NONE)
-			{
-				const auto owner = GetOwner<nGameObject>();
-				const auto stateComp = owner->GetComponent<StateComponent>(ComponentType::STATE);
-				if (!stateComp)
-					return;
-				stateComp->ApplyStatusEffect(dmgInfo.elementalDamage);
-			}
-
-			// 角色特效
-			const auto character = std::dynamic_pointer_cast<Character>(owner);
-			if (!character || character->GetType() != CharacterType::PLAYER)
-				return;
-
-			// 觸發Camera抖動
-			EventManager::TriggerCameraShake();
+			HandleTakeDamage(dmgInfo);
 			break;
 		}
 	default:
@@ -126,6 +93,45 @@ std::vector<EventType> HealthComponent::SubscribedEventTypes() const
 	};
 }
 
+void HealthComponent::HandleTakeDamage(const TakeDamageEventInfo &dmgInfo)
+{
+	const auto ObjectID = dmgInfo.m_Id;
+	// 冷卻中就不處理
+	if (m_recentAttackSources.count(ObjectID) > 0)
+		return;
+	m_recentAttackSources[ObjectID] = m_invincibleDuration;
+
+	// 如果是暴擊，播放暴擊音效
+	if (dmgInfo.isCriticalHit)
+	{
+		static const SFXHandle s_CriticalHitSFX = AudioManager::GetInstance().GetSFXHandle("critical_hit");
+		AudioManager::GetInstance().PlaySFX(s_CriticalHitSFX);
+	}
+
+	TakeDamage(dmgInfo.damage);
+
+	const auto owner = GetOwner<nGameObject>();
+	if (!owner)
+		return;
+	// 元素傷害
+	if (dmgInfo.elementalDamage != StatusEffect::NONE)
+	{
+		const auto owner = GetOwner<nGameObject>();
+		const auto stateComp = owner->GetComponent<StateComponent>(ComponentType::STATE);
+		if (!stateComp)
+			return;
+		stateComp->ApplyStatusEffect(dmgInfo.elementalDamage);
+	}
+
+	// 角色特效
+	const auto character = std::dynamic_pointer_cast<Character>(owner);
+	if (!character || character->GetType() != CharacterType::PLAYER)
+		return;
+
+	// 觸發Camera抖動
+	EventManager::TriggerCameraShake();
+}
+
 // 只處理碰撞傷害 - 被怪物撞、陷阱、尖刺
 void HealthComponent::HandleCollision(const CollisionEventInfo &info)
 {
@@ -316,7 +322,8 @@ void HealthComponent::OnDeath()
 		EventManager::enemyDeathEvent();
 
 		// 播放敵人死亡音效
-		AudioManager::GetInstance().PlaySFX("enemy_die");
+		static const SFXHandle s_EnemyDieSFX = AudioManager::GetInstance().GetSFXHandle("enemy_die");
+		AudioManager::GetInstance().PlaySFX(s_EnemyDieSFX);
 
 		// LOG_DEBUG("HealthComponent::Enemy died, event sent");
 		if (auto aiComp = character->GetComponent<AIComponent>(ComponentType::AI))
@@ -48,9 +48,14 @@ void MovementComponent::Update()
 	constexpr float baseSpeed = 120.0f; // 基础速度
 	const float effectiveMaxSpeed = baseSpeed * m_currentSpeedRatio;
 
+	// 分離只修正正在移動的方向，站著的敵人不會被推著走
+	glm::vec2 desiredDirection = m_DesiredDirection;
+	if (glm::length(desiredDirection) > 0.01f && glm::length(m_Separation) > 0.01f)
+		desiredDirection = glm::normalize(desiredDirection) + m_Separation;
+
 	// 確保輸入方向已正規化
 	glm::vec2 inputDir =
-		(glm::length(m_DesiredDirection) > 0.01f) ? glm::normalize(m_DesiredDirection) : glm::vec2(0.0f);
+		(glm::length(desiredDirection) > 0.01f) ? glm::normalize(desiredDirection) : glm::vec2(0.0f);
 
 	// 當前速度計算
 	float currentSpeed = glm::length(m_Velocity);
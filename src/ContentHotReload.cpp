@@ -0,0 +1,97 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "ContentHotReload.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include "Factory/CharacterFactory.hpp"
+#include "Factory/RoomObjectFactory.hpp"
+#include "Room/RoomPrefabCache.hpp"
+#include "Util/ContentPack.hpp"
+#include "Util/FileWatcher.hpp"
+#include "Util/Logger.hpp"
+#include "json.hpp"
+
+ContentHotReload &ContentHotReload::GetInstance()
+{
+	static ContentHotReload instance;
+	return instance;
+}
+
+ContentHotReload::ContentHotReload() = default;
+
+ContentHotReload::~ContentHotReload() = default;
+
+void ContentHotReload::Start()
+{
+#ifdef CONTENT_HOT_RELOAD
+	if (m_Watcher)
+		return;
+	m_Watcher = std::make_unique<Util::FileWatcher>(JSON_DIR);
+	LOG_INFO("ContentHotReload: watching {}", JSON_DIR);
+#endif
+}
+
+void ContentHotReload::Stop() { m_Watcher.reset(); }
+
+void ContentHotReload::Poll()
+{
+	if (!m_Watcher)
+		return;
+	for (const auto &path : m_Watcher->TakeChanges())
+	{
+		if (std::filesystem::path(path).extension() != ".json")
+			continue;
+
+		std::ifstream file(JSON_DIR "/" + path);
+		if (!file.is_open() || !nlohmann::json::accept(file))
+		{
+			LOG_WARN("ContentHotReload: {} is not valid json, keeping the old data", path);
+			continue;
+		}
+		LOG_INFO("ContentHotReload: reloading {}", path);
+		InvalidateCaches(path);
+
+		// 回呼裏可能取消訂閱，複製一份再通知
+		const auto listeners = m_Listeners;
+		for (const auto &[id, listener] : listeners)
+			listener(path);
+	}
+}
+
+ContentHotReload::ListenerID ContentHotReload::Subscribe(Listener listener)
+{
+	const ListenerID id = m_NextListenerID++;
+	m_Listeners.emplace_back(id, std::move(listener));
+	return id;
+}
+
+void ContentHotReload::Unsubscribe(const ListenerID listenerID)
+{
+	m_Listeners.erase(std::remove_if(m_Listeners.begin(), m_Listeners.end(),
+									 [listenerID](const auto &entry) { return entry.first == listenerID; }),
+					  m_Listeners.end());
+}
+
+void ContentHotReload::InvalidateCaches(const std::string &relativePath)
+{
+	// 內容包是建置時的舊版本，這個檔案之後一律讀文字檔
+	Util::ContentPack::GetInstance().Override(relativePath);
+
+	// 佈局：快取的key是完整路徑（Loader組出來的 JSON_DIR "/主題/房間類型/佈局.json"）
+	RoomPrefabCache::GetInstance().Invalidate(JSON_DIR "/" + relativePath);
+
+	if (relativePath == "enemy.json" || relativePath == "npc.json")
+		CharacterFactory::GetInstance().ReloadJson();
+
+	// 主題/ObjectData/*.json：整個主題的物件定義表重讀；地形碰撞跟物件尺寸有關，地形快取也一起丟
+	if (const auto pos = relativePath.find("/ObjectData/"); pos != std::string::npos)
+	{
+		RoomObjectFactory::InvalidateObjectDataTable(relativePath.substr(0, pos));
+		RoomPrefabCache::GetInstance().Clear();
+	}
+	// weapon.json、AudioConfig.json 等每次使用都重讀，改讀文字檔就夠了
+}
@@ -11,6 +11,7 @@
 #include "Components/AiComponent.hpp"
 #include "Components/CollisionComponent.hpp"
 #include "Components/EnemyAI/AttackStrategy.hpp"
+#include "Components/EnemyAI/BehaviorTree.hpp"
 #include "Components/EnemyAI/MoveStrategy.hpp"
 #include "Components/EnemyAI/UtilityStrategy.hpp"
 #include "Components/FollowerComponent.hpp"
@@ -21,6 +22,7 @@
 #include "Components/TalentComponet.hpp"
 #include "Components/WalletComponent.hpp"
 
+#include "Util/Image.hpp"
 #include "Util/Logger.hpp"
 
 CharacterFactory *CharacterFactory::instance = nullptr;
@@ -212,26 +214,6 @@ MonsterType stringToMonsterType(const std::string &stateStr)
 		return MonsterType::BOSS;
 }
 
-std::unordered_map<AttackStrategies, std::shared_ptr<IAttackStrategy>>
-stringToAtkStrategies(const nlohmann::json &atkStrategies)
-{
-	std::unordered_map<AttackStrategies, std::shared_ptr<IAttackStrategy>> strategies;
-	for (const auto &atkType : atkStrategies)
-	{
-		if (atkType == "Collision")
-			strategies[AttackStrategies::COLLISION_ATTACK] = std::make_shared<CollisionAttack>();
-		if (atkType == "Melee")
-			strategies[AttackStrategies::MELEE] = std::make_shared<MeleeAttack>();
-		if (atkType == "Gun")
-			strategies[AttackStrategies::GUN] = std::make_shared<GunAttack>();
-		if (atkType == "Boss")
-			strategies[AttackStrategies::BOSS] = std::make_shared<BossAttackStrategy>();
-		if (atkType == "None")
-			strategies[AttackStrategies::NONE] = std::make_shared<NoAttack>();
-	}
-	return strategies;
-}
-
 bool JsonArrayContains(const nlohmann::json &array, const std::string &target)
 {
 	if (!array.is_array())
@@ -243,92 +225,209 @@ bool JsonArrayContains(const nlohmann::json &array, const std::string &target)
 
 std::shared_ptr<Character> CharacterFactory::createEnemy(const int id)
 {
-	// 在 JSON 陣列中搜尋符合名稱的角色
-	for (const auto &characterInfo : enemyJsonData)
+	EnemyArchetype *archetype = FindEnemyArchetype(id);
+	if (!archetype)
 	{
-		if (characterInfo["ID"] == id)
+		LOG_ERROR("{}'s ID not found: {}", id);
+		return nullptr;
+	}
+	return InstantiateEnemy(*archetype);
+}
+
+EnemyArchetype *CharacterFactory::FindEnemyArchetype(const int id)
+{
+	if (const auto it = m_EnemyArchetypes.find(id); it != m_EnemyArchetypes.end())
+		return &it->second;
+
+	// 每個ID只在第一次用到時掃一次json
+	const auto it = std::find_if(enemyJsonData.begin(), enemyJsonData.end(),
+								 [id](const nlohmann::json &info) { return info["ID"] == id; });
+	if (it == enemyJsonData.end())
+		return nullptr;
+	return &m_EnemyArchetypes.emplace(id, ParseEnemyArchetype(*it)).first->second;
+}
+
+EnemyArchetype CharacterFactory::ParseEnemyArchetype(const nlohmann::json &characterInfo)
+{
+	EnemyArchetype archetype;
+	archetype.name = characterInfo["name"].get<std::string>();
+	archetype.type = stringToCharacterType(characterInfo["Type"].get<std::string>());
+	archetype.isElite = characterInfo["isElite"].get<bool>();
+	archetype.aiType = stringToMonsterType(characterInfo["monsterType"].get<std::string>());
+	archetype.monsterPoint = characterInfo["monsterPoint"].get<int>();
+	archetype.maxHp = characterInfo["maxHp"].get<int>();
+	archetype.moveSpeed = characterInfo["speed"].get<float>();
+	archetype.colliderSize = glm::vec2(characterInfo["size"].get<float>());
+
+	// 動畫只記下路徑與播放參數，幀圖等到真的生成時才建立
+	for (const auto &[key, value] : characterInfo["animations"].items())
+	{
+		AnimationClip clip;
+		clip.state = stringToState(key);
+		if (value.is_object() && value.contains("path"))
 		{
-			std::string name = characterInfo["name"].get<std::string>();
-			CharacterType type = stringToCharacterType(characterInfo["Type"].get<std::string>());
-			std::shared_ptr<Character> enemy = std::make_shared<Character>(name, type);
-			enemy->SetZIndexType(ZIndexType::OBJECTHIGH);
+			for (const auto &frame : value["path"])
+				clip.paths.push_back(RESOURCE_DIR + frame.get<std::string>());
+			if (value.contains("FPS"))
+				clip.interval = 1000.0f / value["FPS"].get<int>();
+			if (value.contains("Loop"))
+				clip.loop = value["Loop"].get<bool>();
+		}
+		else if (value.is_array())
+		{
+			for (const auto &frame : value)
+				clip.paths.push_back(RESOURCE_DIR + frame.get<std::string>());
+			clip.loop = true;
+		}
+		else
+			throw std::invalid_argument("Unknown animation format");
+		archetype.clips.push_back(std::move(clip));
+	}
 
-			// 檢查是否是精英形態
-			if (characterInfo["isElite"].get<bool>() == true)
-				enemy->m_Transform.scale = glm::vec2(1.4f);
-			auto animation = parseCharacterAnimations(characterInfo["animations"]);
-			MonsterType aiType = stringToMonsterType(characterInfo["monsterType"].get<std::string>());
-			int monsterPoint = characterInfo["monsterPoint"].get<int>();
-			int maxHp = characterInfo["maxHp"].get<int>();
-			float moveSpeed = characterInfo["speed"].get<float>();
-			float bodySize = characterInfo["size"].get<float>();
-			std::shared_ptr<Weapon> weapon = nullptr;
-			int collisionDamage = 0;
-
-			// AIComponent
-			std::shared_ptr<IMoveStrategy> moveStrategy;
-			auto attackStrategies = stringToAtkStrategies(characterInfo["attackType"]);
-			bool isCollisionAttack = JsonArrayContains(characterInfo["attackType"], "Collision");
-			std::shared_ptr<IUtilityStrategy> utilityStrategy = nullptr;
-			if (aiType == MonsterType::SUMMON)
-			{
-				moveStrategy = std::make_shared<NoMove>();
-				utilityStrategy = std::make_shared<SummonUtility>();
-			}
-			else if (aiType == MonsterType::ATTACK)
-			{
-				moveStrategy = std::make_shared<ChaseMove>();
-			}
-			else if (aiType == MonsterType::WANDER)
-			{
-				moveStrategy = std::make_shared<WanderMove>();
-			}
-			else if (aiType == MonsterType::BOSS)
-				moveStrategy = std::make_shared<BossMove>();
-			else
-				LOG_ERROR("{}'s moveType not found", id);
-
-			// 根據攻擊類型
-			int haveWeapon = characterInfo["haveWeapon"].get<int>();
-			if (haveWeapon == 0)
-			{
-				if (isCollisionAttack)
-					collisionDamage = characterInfo["collisionDamage"].get<int>();
-			}
-			else
-			{
-				const int weaponId = characterInfo["weaponId"].get<int>();
-				weapon = WeaponFactory::createWeapon(weaponId);
-				const auto followComp = weapon->GetComponent<FollowerComponent>(ComponentType::FOLLOWER);
-				followComp->SetFollower(enemy);
-				followComp->Update(); // 直接更新位置
-			}
-			auto animationComp = enemy->AddComponent<AnimationComponent>(ComponentType::ANIMATION, animation);
-			auto flickerComp = enemy->AddComponent<FlickerComponent>(ComponentType::FLICKER);
-			auto stateComp = enemy->AddComponent<StateComponent>(ComponentType::STATE);
-			auto healthComp = enemy->AddComponent<HealthComponent>(ComponentType::HEALTH, maxHp, 0, 0);
-			auto movementComp = enemy->AddComponent<MovementComponent>(ComponentType::MOVEMENT, moveSpeed);
-			auto attackComp =
-				enemy->AddComponent<AttackComponent>(ComponentType::ATTACK, weapon, 0, 0, collisionDamage);
-			auto aiComp = enemy->AddComponent<AIComponent>(ComponentType::AI, aiType, moveStrategy, attackStrategies,
-														   utilityStrategy, monsterPoint);
-			auto collisionComp = enemy->AddComponent<CollisionComponent>(ComponentType::COLLISION);
-			collisionComp->SetCollisionLayer(CollisionLayers_Enemy);
-			if (haveWeapon == 0 && isCollisionAttack)
-				collisionComp->AddCollisionMask(CollisionLayers_Player);
-			collisionComp->AddCollisionMask(CollisionLayers_Terrain);
-			collisionComp->AddCollisionMask(CollisionLayers_DestructibleTerrain);
-			collisionComp->AddCollisionMask(CollisionLayers_Player_Projectile);
-			collisionComp->AddCollisionMask(CollisionLayers_Player_EffectAttack);
-			collisionComp->SetSize(glm::vec2(bodySize));
-			collisionComp->SetOffset(glm::vec2(0.0f, -6.0f));
-
-			return enemy;
+	// 有行為樹就共用行為樹（json/enemyBehavior.json），否則生成時建立各自的策略物件
+	if (characterInfo.contains("behavior"))
+	{
+		archetype.behaviorTree =
+			BehaviorTreeLibrary::GetInstance().Find(characterInfo["behavior"].get<std::string>());
+		if (!archetype.behaviorTree)
+			LOG_ERROR("{}'s behavior tree not found, fallback to strategies", archetype.name);
+	}
+	const auto &attackTypes = characterInfo["attackType"];
+	if (!archetype.behaviorTree)
+	{
+		static const std::unordered_map<std::string, AttackStrategies> strategyMap = {
+			{"Collision", AttackStrategies::COLLISION_ATTACK}, {"Melee", AttackStrategies::MELEE},
+			{"Gun", AttackStrategies::GUN}, {"Boss", AttackStrategies::BOSS}, {"None", AttackStrategies::NONE}};
+		for (const auto &atkType : attackTypes)
+			if (const auto it = strategyMap.find(atkType.get<std::string>()); it != strategyMap.end())
+				archetype.attackStrategies.push_back(it->second);
+	}
+
+	// 根據攻擊類型決定武器、碰撞傷害與碰撞遮罩
+	archetype.collisionMask = static_cast<uint8_t>(CollisionLayers_Terrain | CollisionLayers_DestructibleTerrain |
+												   CollisionLayers_Player_Projectile |
+												   CollisionLayers_Player_EffectAttack);
+	if (characterInfo["haveWeapon"].get<int>() == 0)
+	{
+		if (JsonArrayContains(attackTypes, "Collision"))
+		{
+			archetype.collisionDamage = characterInfo["collisionDamage"].get<int>();
+			archetype.collisionMask |= CollisionLayers_Player;
 		}
 	}
+	else
+		archetype.weaponId = characterInfo["weaponId"].get<int>();
+	return archetype;
+}
 
-	LOG_ERROR("{}'s ID not found: {}", id);
-	return nullptr;
+std::shared_ptr<Character> CharacterFactory::InstantiateEnemy(EnemyArchetype &archetype)
+{
+	// 同種敵人共用幀圖：只有第一隻會建立材質
+	if (!archetype.framesLoaded)
+	{
+		for (auto &clip : archetype.clips)
+		{
+			clip.frames.reserve(clip.paths.size());
+			for (const auto &path : clip.paths)
+				clip.frames.push_back(std::make_shared<Util::Image>(path));
+		}
+		archetype.framesLoaded = true;
+	}
+
+	std::shared_ptr<Character> enemy = std::make_shared<Character>(archetype.name, archetype.type);
+	enemy->SetZIndexType(ZIndexType::OBJECTHIGH);
+	// 檢查是否是精英形態
+	if (archetype.isElite)
+		enemy->m_Transform.scale = glm::vec2(1.4f);
+
+	std::unordered_map<State, std::shared_ptr<Animation>> animation;
+	animation.reserve(archetype.clips.size());
+	for (const auto &clip : archetype.clips)
+		animation[clip.state] = std::make_shared<Animation>(clip.frames, clip.loop, clip.interval, "Animation");
+
+	// 策略物件帶有各自的狀態，仍然每隻一份；有行為樹時完全不用建立
+	std::shared_ptr<IMoveStrategy> moveStrategy;
+	std::unordered_map<AttackStrategies, std::shared_ptr<IAttackStrategy>> attackStrategies;
+	std::shared_ptr<IUtilityStrategy> utilityStrategy = nullptr;
+	if (archetype.behaviorTree)
+	{
+		// 移動與攻擊都由行為樹決定
+	}
+	else if (archetype.aiType == MonsterType::SUMMON)
+	{
+		moveStrategy = std::make_shared<NoMove>();
+		utilityStrategy = std::make_shared<SummonUtility>();
+	}
+	else if (archetype.aiType == MonsterType::ATTACK)
+		moveStrategy = std::make_shared<ChaseMove>();
+	else if (archetype.aiType == MonsterType::WANDER)
+		moveStrategy = std::make_shared<WanderMove>();
+	else if (archetype.aiType == MonsterType::BOSS)
+		moveStrategy = std::make_shared<BossMove>();
+	for (const auto atkType : archetype.attackStrategies)
+	{
+		switch (atkType)
+		{
+		case AttackStrategies::COLLISION_ATTACK:
+			attackStrategies[atkType] = std::make_shared<CollisionAttack>();
+			break;
+		case AttackStrategies::MELEE:
+			attackStrategies[atkType] = std::make_shared<MeleeAttack>();
+			break;
+		case AttackStrategies::GUN:
+			attackStrategies[atkType] = std::make_shared<GunAttack>();
+			break;
+		case AttackStrategies::BOSS:
+			attackStrategies[atkType] = std::make_shared<BossAttackStrategy>();
+			break;
+		case AttackStrategies::NONE:
+			attackStrategies[atkType] = std::make_shared<NoAttack>();
+			break;
+		}
+	}
+
+	std::shared_ptr<Weapon> weapon = nullptr;
+	if (archetype.weaponId >= 0)
+	{
+		weapon = WeaponFactory::createWeapon(archetype.weaponId);
+		const auto followComp = weapon->GetComponent<FollowerComponent>(ComponentType::FOLLOWER);
+		followComp->SetFollower(enemy);
+		followComp->Update(); // 直接更新位置
+	}
+
+	enemy->AddComponent<AnimationComponent>(ComponentType::ANIMATION, std::move(animation));
+	enemy->AddComponent<FlickerComponent>(ComponentType::FLICKER);
+	enemy->AddComponent<StateComponent>(ComponentType::STATE);
+	enemy->AddComponent<HealthComponent>(ComponentType::HEALTH, archetype.maxHp, 0, 0);
+	enemy->AddComponent<MovementComponent>(ComponentType::MOVEMENT, archetype.moveSpeed);
+	enemy->AddComponent<AttackComponent>(ComponentType::ATTACK, weapon, 0, 0, archetype.collisionDamage);
+	enemy->AddComponent<AIComponent>(ComponentType::AI, archetype.aiType, moveStrategy, attackStrategies,
+									 utilityStrategy, archetype.monsterPoint, archetype.behaviorTree);
+	enemy->AddComponent<CollisionComponent>(ComponentType::COLLISION, ComponentType::COLLISION,
+											archetype.colliderSize, archetype.colliderOffset,
+											CollisionLayers_Enemy, archetype.collisionMask);
+	return enemy;
+}
+
+glm::vec2 CharacterFactory::GetEnemyCollisionSize(const int id)
+{
+	if (const EnemyArchetype *archetype = FindEnemyArchetype(id))
+		return archetype->colliderSize; // 與createEnemy設定的碰撞箱相同
+	LOG_ERROR("Enemy ID not found: {}", id);
+	return glm::vec2(16.0f, 16.0f); // 預設大小
+}
+
+void CharacterFactory::ClearCache()
+{
+	// 已生成的敵人仍持有各自的幀圖，這裏只放掉原型的引用
+	m_EnemyArchetypes.clear();
+}
+
+void CharacterFactory::ReloadJson()
+{
+	enemyJsonData = readJsonFile("enemy.json");
+	npcJsonData = readJsonFile("npc.json");
+	ClearCache();
 }
 
 
@@ -4,6 +4,7 @@
 
 #include "Factory/Factory.hpp"
 
+#include "Util/ContentPack.hpp"
 #include "Util/Logger.hpp"
 #include "fstream"
 
@@ -44,6 +45,10 @@ ChestType stringToChestType(const std::string &str)
 
 nlohmann::json Factory::readJsonFile(const std::string &fileName)
 {
+	// 建置時編好的內容包優先，沒有才讀文字檔
+	if (nlohmann::json packed; Util::ContentPack::GetInstance().TryLoadJson(fileName, packed))
+		return packed;
+
 	std::ifstream file(JSON_DIR "/" + fileName);
 	if (!file.is_open())
 	{
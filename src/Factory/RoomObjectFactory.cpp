@@ -4,6 +4,9 @@
 
 #include "Factory/RoomObjectFactory.hpp"
 
+#include <filesystem>
+#include <mutex>
+
 #include "Animation.hpp"
 #include "ImagePoolManager.hpp"
 #include "Loader.hpp"
@@ -17,6 +20,7 @@
 // 新增的頭文件
 #include "Components/AttackComponent.hpp"
 #include "Components/ChestComponent.hpp"
+#include "Components/CollisionComponent.hpp"
 #include "Components/DestructibleEffectComponent.hpp"
 #include "Components/DropComponent.hpp"
 #include "Components/WalletComponent.hpp"
@@ -31,19 +35,138 @@
 #include "Shop/ShopTable.hpp"
 
 
+RoomObjectFactory::RoomObjectFactory(const std::shared_ptr<Loader> &loader) : m_Loader(loader)
+{
+	if (loader)
+		m_ObjectData = AcquireObjectDataTable(*loader);
+}
+
+void RoomObjectFactory::ReloadObjectData()
+{
+	if (const auto loader = m_Loader.lock())
+		m_ObjectData = AcquireObjectDataTable(*loader);
+}
+
+RoomObjectFactory::ObjectDataRegistry &RoomObjectFactory::GetObjectDataRegistry()
+{
+	static ObjectDataRegistry registry;
+	return registry;
+}
+
+void RoomObjectFactory::InvalidateObjectDataTable(const std::string &theme)
+{
+	auto &[mutex, tables] = GetObjectDataRegistry();
+	std::lock_guard lock(mutex);
+	tables.erase(theme);
+}
+
+std::shared_ptr<const RoomObjectFactory::ObjectDataTable> RoomObjectFactory::AcquireObjectDataTable(Loader &loader)
+{
+	auto &[mutex, tables] = GetObjectDataRegistry();
+	std::lock_guard lock(mutex);
+	if (const auto it = tables.find(loader.GetTheme()); it != tables.end())
+		return it->second;
+
+	auto table = std::make_shared<ObjectDataTable>();
+	const std::string directory = loader.GetObjectDataDirectory();
+	try
+	{
+		for (const auto &entry : std::filesystem::directory_iterator(directory))
+		{
+			if (!entry.is_regular_file() || entry.path().extension() != ".json")
+				continue;
+			table->emplace(entry.path().stem().string(), ParseObjectData(loader.readJsonFile(entry.path().string())));
+		}
+	}
+	catch (const std::filesystem::filesystem_error &e)
+	{
+		LOG_ERROR("RoomObjectFactory: cannot scan {}: {}", directory, e.what());
+	}
+	LOG_INFO("RoomObjectFactory: cached {} object definitions for theme '{}'", table->size(), loader.GetTheme());
+	tables.emplace(loader.GetTheme(), table);
+	return table;
+}
+
+StructObjectData RoomObjectFactory::ParseObjectData(const nlohmann::json &jsonData)
+{
+	StructObjectData data;
+	if (jsonData.contains("isAnimated"))
+		data.isAnimated = jsonData["isAnimated"].get<bool>();
+	if (jsonData.contains("willPlay"))
+	{
+		data.hasWillPlay = true;
+		data.willPlay = jsonData["willPlay"].get<bool>();
+	}
+	if (jsonData.contains("path"))
+	{
+		data.hasPath = true;
+		data.pathIsArray = jsonData["path"].is_array();
+		if (data.pathIsArray)
+			data.paths = jsonData["path"].get<std::vector<std::string>>();
+		else if (jsonData["path"].is_string())
+			data.paths.push_back(jsonData["path"].get<std::string>());
+		data.resourcePaths.reserve(data.paths.size());
+		for (const auto &path : data.paths)
+			data.resourcePaths.push_back(RESOURCE_DIR + path);
+	}
+	if (jsonData.contains("ZIndex"))
+	{
+		data.hasZIndex = true;
+		data.zIndex = stringToZIndexType(jsonData.at("ZIndex").get<std::string>());
+	}
+	if (jsonData.contains("posOffset"))
+	{
+		const auto &posOffset = jsonData.at("posOffset");
+		data.hasPosOffset = true;
+		data.posOffset = glm::vec2(posOffset[0].get<float>(), posOffset[1].get<float>());
+	}
+	if (jsonData.contains("components"))
+	{
+		for (const auto &componentJson : jsonData.at("components"))
+		{
+			StructObjectComponent component;
+			try
+			{
+				if (componentJson.value("Class", "") == "COLLISION")
+				{
+					component.collision = componentJson.get<StructCollisionComponent>();
+					component.isCollision = true;
+				}
+				else
+					component.json = componentJson;
+			}
+			catch (const std::exception &e)
+			{
+				LOG_ERROR("RoomObjectFactory::ParseObjectData: {}", e.what());
+				continue;
+			}
+			data.components.push_back(std::move(component));
+		}
+	}
+	return data;
+}
+
+const StructObjectData *RoomObjectFactory::GetObjectData(const std::string &_id) const
+{
+	if (!m_ObjectData)
+		return nullptr;
+	const auto it = m_ObjectData->find(_id);
+	return it == m_ObjectData->end() ? nullptr : &it->second;
+}
+
 // class可能是指定類型再用， 目前都是RoomObject
 std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::string &_id, const std::string &_class)
 {
-	if (!m_ObjectDataFilePath.data())
+	// 物件定義在建構時就已整個主題讀好，這裏只查表
+	static const StructObjectData emptyData;
+	const StructObjectData *objectData = GetObjectData(_id);
+	if (!objectData)
 	{
-		LOG_DEBUG("RoomObjectFactory::createRoomObject no set ObjectDataPath");
-		return nullptr;
+		LOG_DEBUG("RoomObjectFactory::createRoomObject no object data for {}", _id);
+		objectData = &emptyData;
 	}
-	// 是否是動畫
-	bool isAnimated = false;
-	nlohmann::json jsonData = m_Loader.lock()->LoadObjectData(_id);
-	if (jsonData.contains("isAnimated"))
-		isAnimated = jsonData["isAnimated"].get<bool>();
+	const StructObjectData &data = *objectData;
+	const bool isAnimated = data.isAnimated; // 是否是動畫
 
 	std::shared_ptr<nGameObject> roomObject;
 
@@ -58,28 +181,8 @@ std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::stri
 		{
 			LOG_DEBUG("RoomObjectFactory::createRoomObject destructibleObject");
 
-			// 從 JSON 中讀取圖片路徑陣列
-			std::vector<std::string> imagePaths;
-			if (jsonData.contains("path"))
-			{
-				if (jsonData["path"].is_array())
-				{
-					// 如果 path 是陣列，讀取所有圖片路徑
-					auto pathArray = jsonData["path"].get<std::vector<std::string>>();
-					for (const auto &path : pathArray)
-					{
-						imagePaths.push_back(path);
-					}
-				}
-				else if (jsonData["path"].is_string())
-				{
-					// 如果 path 是字串，只有一張圖片
-					imagePaths.push_back(jsonData["path"].get<std::string>());
-				}
-			}
-
-			// 創建 DestructibleObject，傳遞圖片陣列
-			roomObject = std::make_shared<DestructibleObject>(_id, imagePaths);
+			// 創建 DestructibleObject，傳遞圖片陣列（path 是字串時只有一張圖片）
+			roomObject = std::make_shared<DestructibleObject>(_id, data.paths);
 			roomObject->AddComponent<HealthComponent>(ComponentType::HEALTH, 1, 0, 0);
 
 			if (_id == "object_boxRed")
@@ -129,10 +232,8 @@ std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::stri
 			// 特殊处理鸡蛋对象
 			if (isAnimated)
 			{
-				std::vector<std::string> path = jsonData["path"].get<std::vector<std::string>>();
-				for (auto &i : path)
-					i = RESOURCE_DIR + i;
-				std::shared_ptr<Animation> animation = std::make_shared<Animation>(path, true, 0, _class);
+				std::shared_ptr<Animation> animation =
+					std::make_shared<Animation>(data.resourcePaths, true, 0, _class);
 				animation->PlayAnimation(false); // 初始不播放动画
 				roomObject = animation;
 
@@ -156,15 +257,13 @@ std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::stri
 			// 對於其他類型，使用原有邏輯
 			if (isAnimated)
 			{
-				std::vector<std::string> path = jsonData["path"].get<std::vector<std::string>>();
-				for (auto &i : path)
-					i = RESOURCE_DIR + i;
-				std::shared_ptr<Animation> animation = std::make_shared<Animation>(path, true, 0, _class);
+				std::shared_ptr<Animation> animation =
+					std::make_shared<Animation>(data.resourcePaths, true, 0, _class);
 				// TODO interval 間隔
-				if (jsonData.contains("willPlay"))
+				if (data.hasWillPlay)
 				{
 					LOG_INFO("RoomObjectFactory::createRoomObject willPlay");
-					animation->PlayAnimation(jsonData["willPlay"].get<bool>());
+					animation->PlayAnimation(data.willPlay);
 				}
 				else animation->PlayAnimation(true);
 				roomObject = animation;
@@ -181,10 +280,8 @@ std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::stri
 		// 沒有指定 className 時的默認行為
 		if (isAnimated)
 		{
-			std::vector<std::string> path = jsonData["path"].get<std::vector<std::string>>();
-			for (auto &i : path)
-				i = RESOURCE_DIR + i;
-			std::shared_ptr<Animation> animation = std::make_shared<Animation>(path, true, 0, "Animation");
+			std::shared_ptr<Animation> animation =
+				std::make_shared<Animation>(data.resourcePaths, true, 0, "Animation");
 			animation->PlayAnimation(true);
 			roomObject = animation;
 		}
@@ -195,37 +292,30 @@ std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::stri
 	}
 
 	// 設置Drawable（Animation 和 DestructibleObject 已經在構造函數中設置了）
-	if (jsonData.contains("path") && !isAnimated && _class != "DestructibleObject")
+	if (data.hasPath && !isAnimated && _class != "DestructibleObject")
 	{
 		// 對於非 DestructibleObject 的物件，設置單一圖片
-		if (jsonData["path"].is_string())
+		if (!data.pathIsArray && !data.resourcePaths.empty())
 		{
-			roomObject->SetDrawable(
-				ImagePoolManager::GetInstance().GetImage(RESOURCE_DIR + jsonData.at("path").get<std::string>()));
+			roomObject->SetDrawable(ImagePoolManager::GetInstance().GetImage(data.resourcePaths.front()));
 		}
-		else if (jsonData["path"].is_array())
+		else if (!data.resourcePaths.empty())
 		{
 			// 如果是陣列，隨機選擇一張圖片
-			auto pathArray = jsonData["path"].get<std::vector<std::string>>();
-			if (!pathArray.empty())
-			{
-				// 使用 RandomUtil 隨機選擇一個索引
-				int randomIndex = RandomUtil::RandomIntInRange(0, static_cast<int>(pathArray.size()) - 1);
-				roomObject->SetDrawable(
-					ImagePoolManager::GetInstance().GetImage(RESOURCE_DIR + pathArray[randomIndex]));
-			}
+			// 使用 RandomUtil 隨機選擇一個索引
+			int randomIndex = RandomUtil::RandomIntInRange(0, static_cast<int>(data.resourcePaths.size()) - 1);
+			roomObject->SetDrawable(ImagePoolManager::GetInstance().GetImage(data.resourcePaths[randomIndex]));
 		}
 	}
-	else if (!jsonData.contains("path") && !isAnimated)
+	else if (!data.hasPath && !isAnimated)
 	{
 		LOG_WARN("RoomObjectFactory::createRoomObject: No path for {}", _id);
 	}
 
 	// 設置ZIndexLayer
-	if (jsonData.contains("ZIndex"))
+	if (data.hasZIndex)
 	{
-		const auto zIndexStr = jsonData.at("ZIndex").get<std::string>();
-		roomObject->SetZIndexType(stringToZIndexType(zIndexStr));
+		roomObject->SetZIndexType(data.zIndex);
 	}
 	else
 	{
@@ -235,21 +325,18 @@ std::shared_ptr<nGameObject> RoomObjectFactory::CreateRoomObject(const std::stri
 	}
 
 	// 設置posOffset
-	if (jsonData.contains("posOffset"))
-	{
-		const auto data_posOffset = jsonData.at("posOffset");
-		const auto posOffset = glm::vec2(data_posOffset[0].get<float>(), data_posOffset[1].get<float>());
-		roomObject->SetPosOffset(posOffset);
-	}
+	if (data.hasPosOffset)
+		roomObject->SetPosOffset(data.posOffset);
 
-	// 設置Components
-	if (!jsonData.contains("components"))
-		return roomObject; // 沒有就跳過
-	for (auto &component : jsonData.at("components"))
+	// 設置Components（碰撞箱已預先解析，其他元件照舊由Factory建立）
+	for (const auto &component : data.components)
 	{
 		try
 		{
-			Factory::createComponent(roomObject, component);
+			if (component.isCollision)
+				roomObject->AddComponent<CollisionComponent>(ComponentType::COLLISION, component.collision);
+			else
+				Factory::createComponent(roomObject, component.json);
 		}
 		catch (const std::exception &e)
 		{
@@ -5,6 +5,8 @@
 #include "Loader.hpp"
 #include <fstream>
 #include "Room/RoomLayoutManager.hpp"
+#include "Room/RoomPrefabCache.hpp"
+#include "Util/ContentPack.hpp"
 #include "Util/Logger.hpp"
 
 
@@ -14,18 +16,23 @@ Loader::Loader(std::string theme) : m_Theme(std::move(theme))
 	m_LayoutManager = std::make_shared<RoomLayoutManager>(m_Theme);
 }
 
-nlohmann::ordered_json Loader::LoadMonsterRoomObjectPosition_Random()
+std::shared_ptr<const RoomPrefab> Loader::LoadMonsterRoomObjectPosition_Random()
 {
 	std::string layoutName = m_LayoutManager->GetRandomLayout("MonsterRoom");
 	std::string filePath = JSON_DIR "/" + m_Theme + "/MonsterRoom/" + layoutName + ".json";
-	return readJsonFile(filePath);
+	return LoadRoomPrefab(filePath);
 }
 
-nlohmann::ordered_json Loader::LoadMonsterRoomObjectPosition_Specific(const std::string &layoutName)
+std::shared_ptr<const RoomPrefab> Loader::LoadMonsterRoomObjectPosition_Specific(const std::string &layoutName)
 {
 	std::string selectedLayout = m_LayoutManager->GetSpecificLayout(layoutName, "MonsterRoom");
 	std::string filePath = JSON_DIR "/" + m_Theme + "/MonsterRoom/" + selectedLayout + ".json";
-	return readJsonFile(filePath);
+	return LoadRoomPrefab(filePath);
+}
+
+std::shared_ptr<const RoomPrefab> Loader::LoadRoomPrefab(const std::string &layoutPath)
+{
+	return RoomPrefabCache::GetInstance().GetPrefab(layoutPath, *this);
 }
 
 std::vector<std::string> Loader::GetAllMonsterRoomLayouts() const
@@ -35,6 +42,10 @@ std::vector<std::string> Loader::GetAllMonsterRoomLayouts() const
 
 nlohmann::ordered_json Loader::readJsonFile(const std::string &filePath)
 {
+	// 建置時編好的內容包優先，沒有才讀文字檔
+	if (nlohmann::ordered_json packed; Util::ContentPack::GetInstance().TryLoadJson(filePath, packed))
+		return packed;
+
 	std::ifstream file(filePath);
 	if (!file.is_open())
 	{
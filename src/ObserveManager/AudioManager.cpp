@@ -4,8 +4,11 @@
 
 #include "ObserveManager/AudioManager.hpp"
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <tuple>
 #include "Util/BGM.hpp"
+#include "Util/ContentPack.hpp"
 #include "Util/Logger.hpp"
 #include "Util/SFX.hpp"
 #include "json.hpp"
@@ -20,30 +23,59 @@ AudioManager &AudioManager::GetInstance()
 	return instance;
 }
 
+SFXHandle AudioManager::GetSFXHandle(const std::string &name)
+{
+	if (const auto it = m_SFXHandles.find(name); it != m_SFXHandles.end())
+		return it->second;
+
+	// 還沒登記的名稱也先配代號，之後設定檔登記時補上路徑
+	const auto handle = static_cast<SFXHandle>(m_SFXEntries.size());
+	SFXEntry entry;
+	entry.name = name;
+	m_SFXEntries.push_back(std::move(entry));
+	m_SFXHandles.emplace(name, handle);
+	return handle;
+}
+
 void AudioManager::PlaySFX(const std::string &name)
 {
-	if (m_Muted || m_SFXs.find(name) == m_SFXs.end())
+	const auto it = m_SFXHandles.find(name);
+	if (it == m_SFXHandles.end())
 	{
 		LOG_DEBUG("AudioManager::PlaySFX: No such SFX: " + name);
 		return;
 	}
-	auto &sfx = m_SFXs[name];
+	PlaySFX(it->second);
+}
+
+void AudioManager::PlaySFX(const SFXHandle handle)
+{
+	if (m_Muted)
+		return;
+	SFXEntry *entry = AcquireSFX(handle);
+	if (!entry)
+		return;
+
+	ReserveVoice(handle, *entry);
 	int volume = static_cast<int>(128 * m_MasterVolume * m_SFXVolume);
-	sfx->SetVolume(std::clamp(volume, 0, 128));
-	sfx->Play();
+	entry->sfx->SetVolume(std::clamp(volume, 0, 128));
+	TrackVoice(handle, *entry, entry->sfx->Play());
 }
 
 void AudioManager::FadeInSFX(const std::string &name, unsigned int tick, int loop, unsigned int duration)
 {
-	if (m_Muted || m_SFXs.find(name) == m_SFXs.end())
+	const auto it = m_SFXHandles.find(name);
+	SFXEntry *entry = (m_Muted || it == m_SFXHandles.end()) ? nullptr : AcquireSFX(it->second);
+	if (!entry)
 	{
 		LOG_DEBUG("AudioManager::FadeInSFX: No such SFX: " + name);
 		return;
 	}
-	auto &sfx = m_SFXs[name];
+
+	ReserveVoice(it->second, *entry);
 	int volume = static_cast<int>(128 * m_MasterVolume * m_SFXVolume);
-	sfx->SetVolume(std::clamp(volume, 0, 128));
-	sfx->FadeIn(tick, loop, duration);
+	entry->sfx->SetVolume(std::clamp(volume, 0, 128));
+	TrackVoice(it->second, *entry, entry->sfx->FadeIn(tick, loop, duration));
 }
 
 // void AudioManager::PlayBGM(bool loop)
@@ -60,16 +92,29 @@ void AudioManager::FadeInSFX(const std::string &name, unsigned int tick, int loo
 
 void AudioManager::PlayBGM(const std::string &name, bool loop)
 {
-	if (m_Muted || m_BGMs.find(name) == m_BGMs.end())
+	const auto it = m_BGMPaths.find(name);
+	if (m_Muted || it == m_BGMPaths.end())
 	{
 		return;
 	}
 
-	// 切換到新BGM（Play會自動停止當前播放的BGM）
-	m_BGM = m_BGMs[name];
+	// 切換到新BGM（Play會自動停止當前播放的BGM），舊的那首播完新的之後才關檔
+	auto previous = m_BGM;
+	const std::string previousPath = m_BGMPath;
+	if (!m_BGM || m_BGMPath != it->second)
+	{
+		m_BGM = std::make_shared<Util::BGM>(it->second);
+		m_BGMPath = it->second;
+	}
 	int volume = static_cast<int>(128 * m_MasterVolume * m_BGMVolume);
 	m_BGM->SetVolume(std::clamp(volume, 0, 128));
 	m_BGM->Play(loop ? -1 : 0);
+
+	if (previous && previousPath != m_BGMPath)
+	{
+		previous.reset();
+		Util::BGM::Release(previousPath);
+	}
 }
 
 void AudioManager::FadeInBGM(int tick, int loop)
@@ -121,8 +166,9 @@ void AudioManager::SetBGMVolume(float volume)
 void AudioManager::RefreshAllVolumes()
 {
 	const int sfx_volume = static_cast<int>(128 * m_MasterVolume * m_SFXVolume);
-	for (auto &[_, sfx] : m_SFXs)
-		sfx->SetVolume(std::clamp(sfx_volume, 0, 128));
+	for (auto &entry : m_SFXEntries)
+		if (entry.sfx)
+			entry.sfx->SetVolume(std::clamp(sfx_volume, 0, 128));
 
 	if (m_BGM)
 	{
@@ -139,52 +185,66 @@ void AudioManager::Mute(bool mute)
 	{
 		if (m_BGM)
 			m_BGM->SetVolume(0);
-		for (auto &[_, sfx] : m_SFXs)
-			sfx->SetVolume(0);
+		for (auto &entry : m_SFXEntries)
+			if (entry.sfx)
+				entry.sfx->SetVolume(0);
 	}
 	else
 	{
-		if (m_BGM)
-		{
-			int volume = static_cast<int>(128 * m_MasterVolume * m_BGMVolume);
-			m_BGM->SetVolume(std::clamp(volume, 0, 128));
-		}
-		for (auto &[_, sfx] : m_SFXs)
-		{
-			int volume = static_cast<int>(128 * m_MasterVolume * m_SFXVolume);
-			sfx->SetVolume(std::clamp(volume, 0, 128));
-		}
+		RefreshAllVolumes();
 	}
 }
 
-void AudioManager::RegisterSFX(const std::string &name, const std::string &path)
+void AudioManager::RegisterSFX(const std::string &name, const std::string &path, const int maxVoices)
 {
-	m_SFXs[name] = std::make_shared<Util::SFX>(path);
+	SFXEntry &entry = m_SFXEntries[GetSFXHandle(name)];
+	if (entry.path != path)
+	{
+		UnloadSFX(entry);
+		entry.path = path;
+		std::error_code error;
+		const auto fileSize = std::filesystem::file_size(path, error);
+		entry.bytes = error ? 0 : static_cast<size_t>(fileSize);
+	}
+	entry.maxVoices = std::max(maxVoices, 1);
+	entry.registered = true;
 }
 
-void AudioManager::RegisterBGM(const std::string &path) { m_BGM = std::make_shared<Util::BGM>(path); }
-
-void AudioManager::RegisterBGM(const std::string &name, const std::string &path)
+void AudioManager::RegisterBGM(const std::string &path)
 {
-	m_BGMs[name] = std::make_shared<Util::BGM>(path);
+	if (m_BGM && m_BGMPath == path)
+		return;
+	ReleaseBGM();
+	m_BGM = std::make_shared<Util::BGM>(path);
+	m_BGMPath = path;
 }
 
-void AudioManager::LoadFromJson(const std::string &path)
+void AudioManager::RegisterBGM(const std::string &name, const std::string &path) { m_BGMPaths[name] = path; }
+
+void AudioManager::LoadFromJson(const std::string &path, const std::string &sfxSet)
 {
-	std::ifstream inFile(JSON_DIR + path);
-	if (!inFile.is_open())
+	json j;
+	if (!Util::ContentPack::GetInstance().TryLoadJson(path, j))
 	{
-		return;
+		std::ifstream inFile(JSON_DIR + path);
+		if (!inFile.is_open())
+		{
+			return;
+		}
+		inFile >> j;
 	}
 
-	json j;
-	inFile >> j;
+	// 連射時同時發聲的數量變多，預設的8個聲道不夠用
+	if (Mix_AllocateChannels(-1) < MIXER_CHANNELS)
+		Mix_AllocateChannels(MIXER_CHANNELS);
 
 	if (j.contains("sfx"))
 	{
+		const json &maxVoices = j.contains("sfx_max_voices") ? j["sfx_max_voices"] : json::object();
 		for (auto &[name, sfxPath] : j["sfx"].items())
 		{
-			RegisterSFX(name, RESOURCE_DIR + sfxPath.get<std::string>());
+			RegisterSFX(name, RESOURCE_DIR + sfxPath.get<std::string>(),
+						maxVoices.value(name, static_cast<int>(DEFAULT_MAX_VOICES)));
 		}
 	}
 	if (j.contains("bgm"))
@@ -194,13 +254,150 @@ void AudioManager::LoadFromJson(const std::string &path)
 			RegisterBGM(name, RESOURCE_DIR + bgmPath.get<std::string>());
 		}
 	}
+
+	for (auto &entry : m_SFXEntries)
+		entry.inSceneSet = false;
+	if (!sfxSet.empty())
+	{
+		const json &sets = j.contains("sfx_sets") ? j["sfx_sets"] : json::object();
+		if (!sets.contains(sfxSet))
+			LOG_WARN("AudioManager: no sfx set '{}', its SFX are decoded on first play", sfxSet);
+		else
+			for (const auto &name : sets[sfxSet])
+			{
+				const auto it = m_SFXHandles.find(name.get<std::string>());
+				if (it == m_SFXHandles.end() || !m_SFXEntries[it->second].registered)
+				{
+					LOG_WARN("AudioManager: sfx set '{}' lists unknown SFX '{}'", sfxSet, name.get<std::string>());
+					continue;
+				}
+				m_SFXEntries[it->second].inSceneSet = true;
+			}
+	}
+
+	// 先放掉上一個場景的音效（新設定檔沒有的、這個場景用不到的），再一次解碼這個場景的音效組，
+	// 遊戲中第一次開槍、爆炸就不必在那一幀讀檔解碼
+	for (auto &entry : m_SFXEntries)
+		if (!entry.registered || !entry.inSceneSet)
+			UnloadSFX(entry);
+	for (auto &entry : m_SFXEntries)
+		if (entry.inSceneSet)
+			LoadSFX(entry);
+	if (m_LoadedSFXBytes > SFX_MEMORY_BUDGET)
+		LOG_WARN("AudioManager: sfx set '{}' is larger than the SFX memory budget", sfxSet);
 }
 
 void AudioManager::Reset()
 {
-	m_SFXs.clear();
+	// 只清掉登記，代號保留；已解碼的音效等下一份設定檔決定去留，正在播的BGM也不打斷
+	for (auto &entry : m_SFXEntries)
+		entry.registered = false;
+	m_BGMPaths.clear();
+}
+
+AudioManager::SFXEntry *AudioManager::AcquireSFX(const SFXHandle handle)
+{
+	if (handle < 0 || handle >= static_cast<SFXHandle>(m_SFXEntries.size()))
+		return nullptr;
+	SFXEntry &entry = m_SFXEntries[handle];
+	if (!entry.registered)
+	{
+		LOG_DEBUG("AudioManager: No such SFX: " + entry.name);
+		return nullptr;
+	}
+
+	entry.lastPlayed = ++m_PlayCounter;
+	if (!entry.sfx)
+	{
+		// 只有不在場景音效組裏的才會走到這裏；常常出現的話該把它加進 "sfx_sets"
+		LOG_DEBUG("AudioManager: SFX not in the scene's sfx set, decoding on play: " + entry.name);
+		LoadSFX(entry);
+		EvictSFX(handle);
+	}
+	return &entry;
+}
+
+void AudioManager::ReserveVoice(const SFXHandle handle, SFXEntry &entry)
+{
+	// 清掉已經播完或被別的音效接手的聲道
+	entry.channels.erase(std::remove_if(entry.channels.begin(), entry.channels.end(),
+										[&](const int channel)
+										{ return !Mix_Playing(channel) || m_ChannelOwner[channel] != handle; }),
+						 entry.channels.end());
+	if (static_cast<int>(entry.channels.size()) >= entry.maxVoices)
+	{
+		Mix_HaltChannel(entry.channels.front());
+		entry.channels.erase(entry.channels.begin());
+	}
+}
+
+void AudioManager::TrackVoice(const SFXHandle handle, SFXEntry &entry, const int channel)
+{
+	if (channel < 0)
+		return; // 聲道全滿，這一聲就不播
+	if (channel >= static_cast<int>(m_ChannelOwner.size()))
+		m_ChannelOwner.resize(channel + 1, INVALID_SFX_HANDLE);
+	m_ChannelOwner[channel] = handle;
+	entry.channels.push_back(channel);
+}
+
+bool AudioManager::IsPlaying(const SFXHandle handle, const SFXEntry &entry) const
+{
+	return std::any_of(entry.channels.begin(), entry.channels.end(), [&](const int channel)
+					   { return Mix_Playing(channel) && m_ChannelOwner[channel] == handle; });
+}
+
+void AudioManager::LoadSFX(SFXEntry &entry)
+{
+	if (entry.sfx)
+		return;
+	entry.sfx = std::make_shared<Util::SFX>(entry.path);
+	m_LoadedSFXBytes += entry.bytes;
+}
+
+void AudioManager::UnloadSFX(SFXEntry &entry)
+{
+	if (!entry.sfx)
+		return;
+	const auto handle = static_cast<SFXHandle>(&entry - m_SFXEntries.data());
+	for (const int channel : entry.channels)
+		if (m_ChannelOwner[channel] == handle)
+			Mix_HaltChannel(channel);
+	entry.channels.clear();
+	entry.sfx.reset();
+	Util::SFX::Release(entry.path);
+	m_LoadedSFXBytes -= std::min(entry.bytes, m_LoadedSFXBytes);
+}
+
+void AudioManager::EvictSFX(const SFXHandle keep)
+{
+	while (m_LoadedSFXBytes > SFX_MEMORY_BUDGET)
+	{
+		SFXEntry *victim = nullptr;
+		for (SFXHandle handle = 0; handle < static_cast<SFXHandle>(m_SFXEntries.size()); ++handle)
+		{
+			SFXEntry &entry = m_SFXEntries[handle];
+			if (!entry.sfx || handle == keep || IsPlaying(handle, entry))
+				continue;
+			// 預算只是最後防線：先淘汰音效組以外的，音效組裏的最後才動
+			if (!victim ||
+				std::tie(entry.inSceneSet, entry.lastPlayed) < std::tie(victim->inSceneSet, victim->lastPlayed))
+				victim = &entry;
+		}
+		if (!victim)
+			break; // 全都在播，先超出預算
+		LOG_DEBUG("AudioManager: evict SFX " + victim->name);
+		UnloadSFX(*victim);
+	}
+}
+
+void AudioManager::ReleaseBGM()
+{
+	if (!m_BGM)
+		return;
 	m_BGM.reset();
-	m_BGMs.clear();
+	Util::BGM::Release(m_BGMPath);
+	m_BGMPath.clear();
 }
 
 void AudioManager::DrawDebugUI()
@@ -267,6 +464,8 @@ void AudioManager::DrawDebugUI()
 		ImGui::Text("Master Volume: %.0f%%", GetMasterVolume() * 100.0f);
 		ImGui::Text("BGM Volume: %.0f%%", GetBGMVolume() * 100.0f);
 		ImGui::Text("SFX Volume: %.0f%%", GetSFXVolume() * 100.0f);
+		ImGui::Text("Loaded SFX: %.1f MB / %.0f MB", static_cast<double>(m_LoadedSFXBytes) / (1024.0 * 1024.0),
+					static_cast<double>(SFX_MEMORY_BUDGET) / (1024.0 * 1024.0));
 	}
 	ImGui::End();
 }
@@ -0,0 +1,248 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Room/AIScheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Camera.hpp"
+#include "Components/AiComponent.hpp"
+#include "Components/AttackComponent.hpp"
+#include "Components/CollisionComponent.hpp"
+#include "Components/MovementComponent.hpp"
+#include "Creature/Character.hpp"
+#include "Room/GridFlowField.hpp"
+#include "Room/GridPathfinder.hpp"
+#include "Scene/SceneManager.hpp"
+#include "Util/WorkStealingPool.hpp"
+#include "Weapon/GunWeapon.hpp"
+#include "config.hpp"
+#include "glm/common.hpp"
+#include "glm/geometric.hpp"
+
+namespace
+{
+	constexpr float NEAR_DISTANCE = 200.0f;
+	constexpr float MID_DISTANCE = 600.0f;
+	constexpr uint32_t COMPACT_INTERVAL = 60; // 每隔幾幀清一次已銷毀的敵人
+} // namespace
+
+void AIScheduler::Register(const std::shared_ptr<Character> &enemy)
+{
+	if (!enemy)
+		return;
+	const auto aiComp = enemy->GetComponent<AIComponent>(ComponentType::AI);
+	if (!aiComp)
+		return;
+	if (m_Enemies.Add(enemy))
+		aiComp->SetScheduled(true);
+}
+
+void AIScheduler::Unregister(const std::shared_ptr<Character> &enemy)
+{
+	if (!enemy || !m_Enemies.Remove(enemy.get()))
+		return;
+	if (const auto aiComp = enemy->GetComponent<AIComponent>(ComponentType::AI))
+		aiComp->SetScheduled(false);
+}
+
+uint32_t AIScheduler::ThinkInterval(const glm::vec2 &enemyPos, const glm::vec2 &playerPos,
+									const glm::vec2 &viewCenter, const glm::vec2 &viewHalfExtent) const
+{
+	const glm::vec2 delta = glm::abs(enemyPos - viewCenter);
+	const bool onScreen = delta.x <= viewHalfExtent.x && delta.y <= viewHalfExtent.y;
+	const float distance = glm::distance(enemyPos, playerPos);
+
+	if (onScreen && distance < NEAR_DISTANCE)
+		return 1;
+	if (onScreen)
+		return 2;
+	if (distance < MID_DISTANCE)
+		return 4;
+	return 12;
+}
+
+void AIScheduler::Update()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	m_Frame++;
+	m_Stats = AISchedulerStats{};
+	if (m_Frame % COMPACT_INTERVAL == 0)
+		m_Enemies.ForEachAlive([](const std::shared_ptr<Character> &) {});
+	m_Stats.registered = m_Enemies.Size();
+	if (m_Enemies.Size() == 0)
+		return;
+
+	// 畫面範圍：鏡頭中心 ± 半個視窗（依縮放換回世界座標）
+	glm::vec2 viewCenter(0.0f);
+	glm::vec2 viewHalfExtent(static_cast<float>(PTSD_Config::WINDOW_WIDTH) / 2.0f,
+							 static_cast<float>(PTSD_Config::WINDOW_HEIGHT) / 2.0f);
+	if (const auto scene = SceneManager::GetInstance().GetCurrentScene().lock())
+	{
+		if (const auto camera = scene->GetCamera().lock())
+		{
+			const auto cameraTransform = camera->GetCameraWorldCoord();
+			viewCenter = cameraTransform.translation;
+			viewHalfExtent /= glm::max(glm::abs(cameraTransform.scale), glm::vec2(0.01f));
+		}
+	}
+	const auto player = m_Player.lock();
+	const glm::vec2 playerPos = player ? player->GetWorldCoord() : viewCenter;
+
+	// 依上一幀量到的單次思考成本換算本幀可以思考幾個
+	const size_t maxThinks =
+		std::max(MIN_THINKS_PER_FRAME, static_cast<size_t>(THINK_BUDGET_MICROS / std::max(m_AvgThinkMicros, 1.0f)));
+
+	// 挑選（序列）：從上一幀停下的位置輪詢，抄下位置與目標形成本幀的唯讀快照
+	const auto &enemies = m_Enemies.Items();
+	const size_t count = enemies.size();
+	if (m_Cursor >= count)
+		m_Cursor = 0;
+
+	m_Batch.clear();
+	m_Predictor.Clear();
+	size_t visited = 0;
+	for (; visited < count; ++visited)
+	{
+		const auto enemy = enemies[(m_Cursor + visited) % count].lock();
+		if (!enemy)
+			continue;
+		if (!enemy->IsActive())
+		{
+			m_Stats.inactive++;
+			continue;
+		}
+		auto aiComp = enemy->GetComponent<AIComponent>(ComponentType::AI);
+		if (!aiComp)
+			continue;
+
+		const glm::vec2 position = enemy->GetWorldCoord();
+		const uint32_t interval = ThinkInterval(position, playerPos, viewCenter, viewHalfExtent);
+		if (m_Frame - aiComp->GetLastThinkFrame() < interval)
+			continue;
+
+		if (m_Batch.size() >= maxThinks)
+		{
+			// 預算用完：下一幀從這個敵人開始
+			m_Stats.dueSkipped++;
+			break;
+		}
+
+		ThinkRequest request;
+		request.position = position;
+		if (const auto target = aiComp->GetTarget().lock())
+		{
+			request.targetPos = target->GetWorldCoord();
+			request.hasTarget = true;
+			// 拿直線子彈槍的敵人：依目標目前速度與子彈速度預判（追蹤彈自己會轉向）
+			const auto attackComp = enemy->GetComponent<AttackComponent>(ComponentType::ATTACK);
+			const auto targetMove = target->GetComponent<MovementComponent>(ComponentType::MOVEMENT);
+			if (attackComp && targetMove)
+			{
+				const auto gun = std::dynamic_pointer_cast<GunWeapon>(attackComp->GetCurrentWeapon());
+				if (gun && !gun->IsBulletTracking() && gun->GetBulletSpeed() > 0.0f)
+					request.aimSlot = static_cast<int>(m_Predictor.Add(position, request.targetPos,
+																		targetMove->GetVelocity(), gun->GetBulletSpeed()));
+			}
+		}
+		request.aiComp = std::move(aiComp);
+		m_Batch.push_back(std::move(request));
+	}
+	m_Cursor = (m_Cursor + visited) % count;
+
+	// 提前量：整批一次算（SoA迴圈），第一階段再各自抄進感知
+	m_Predictor.Solve();
+
+	// 第一階段（平行）：只讀快照與房間導航資料，結果寫進各自的槽位
+	m_Perceptions.resize(m_Batch.size());
+	Util::WorkStealingPool::GetInstance().ParallelFor(m_Batch.size(), PARALLEL_GRAIN,
+													  [this](const size_t begin, const size_t end)
+													  {
+														  for (size_t i = begin; i < end; ++i)
+															  Perceive(m_Batch[i], m_Perceptions[i]);
+													  });
+
+	// 第二階段（序列）：狀態機、元件寫入、生成請求都在主執行緒
+	for (size_t i = 0; i < m_Batch.size(); ++i)
+	{
+		m_Batch[i].aiComp->Think(&m_Perceptions[i]);
+		m_Batch[i].aiComp->SetLastThinkFrame(m_Frame);
+	}
+	m_Stats.thinkCount = m_Batch.size();
+	m_Batch.clear(); // 不延長元件壽命
+
+	UpdateSeparation();
+
+	m_Stats.elapsedMicros = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+	if (m_Stats.thinkCount > 0)
+	{
+		const float perThink = m_Stats.elapsedMicros / static_cast<float>(m_Stats.thinkCount);
+		m_AvgThinkMicros += (perThink - m_AvgThinkMicros) * 0.2f;
+	}
+}
+
+void AIScheduler::UpdateSeparation()
+{
+	// 收集（序列）：只放激活的敵人，半徑取碰撞箱較長邊的一半
+	m_Crowd.Clear();
+	m_CrowdMovers.clear();
+	for (const auto &weakEnemy : m_Enemies.Items())
+	{
+		const auto enemy = weakEnemy.lock();
+		if (!enemy || !enemy->IsActive())
+			continue;
+		auto moveComp = enemy->GetComponent<MovementComponent>(ComponentType::MOVEMENT);
+		const auto collisionComp = enemy->GetComponent<CollisionComponent>(ComponentType::COLLISION);
+		if (!moveComp || !collisionComp)
+			continue;
+		const glm::vec2 size = collisionComp->GetSize();
+		m_Crowd.AddAgent(enemy->GetWorldCoord(), moveComp->GetVelocity(), std::max(size.x, size.y) / 2.0f);
+		m_CrowdMovers.push_back(std::move(moveComp));
+	}
+	m_Stats.crowdAgents = m_CrowdMovers.size();
+	if (m_CrowdMovers.empty())
+		return;
+
+	// 計算（平行，只讀）
+	m_Crowd.Build();
+	m_CrowdPush.resize(m_CrowdMovers.size());
+	Util::WorkStealingPool::GetInstance().ParallelFor(m_CrowdMovers.size(), CROWD_PARALLEL_GRAIN,
+													  [this](const size_t begin, const size_t end)
+													  {
+														  for (size_t i = begin; i < end; ++i)
+															  m_CrowdPush[i] = m_Crowd.Compute(i);
+													  });
+
+	// 寫回（序列）
+	for (size_t i = 0; i < m_CrowdMovers.size(); ++i)
+	{
+		m_CrowdMovers[i]->SetSeparation(m_CrowdPush[i]);
+		if (m_CrowdPush[i] != glm::vec2(0.0f))
+			m_Stats.crowdAdjusted++;
+	}
+	m_CrowdMovers.clear();
+}
+
+void AIScheduler::Perceive(const ThinkRequest &request, AIPerception &perception) const
+{
+	perception = AIPerception{};
+	if (!request.hasTarget)
+		return;
+
+	perception.hasTarget = true;
+	perception.targetPos = request.targetPos;
+	perception.targetDistance = glm::distance(request.position, request.targetPos);
+	if (m_Pathfinder)
+		perception.hasLineOfSight = m_Pathfinder->HasLineOfSight(request.position, request.targetPos);
+	if (m_FlowField)
+		perception.hasFlowDirection = m_FlowField->Sample(request.position, request.targetPos, perception.flowDirection);
+	if (request.aimSlot >= 0)
+	{
+		perception.aimPoint = m_Predictor.GetAimPoint(static_cast<size_t>(request.aimSlot));
+		perception.hasAimPoint = true;
+	}
+}
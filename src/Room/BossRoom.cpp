@@ -46,8 +46,7 @@ void BossRoom::Update()
 
 void BossRoom::LoadFromJSON()
 {
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadBossRoomObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadBossRoomObjectPosition());
 }
 
 void BossRoom::TryActivateByPlayer()
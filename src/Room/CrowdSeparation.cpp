@@ -0,0 +1,106 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Room/CrowdSeparation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "glm/geometric.hpp"
+
+size_t CrowdSeparation::AddAgent(const glm::vec2 &position, const glm::vec2 &velocity, const float radius)
+{
+	m_Agents.push_back({position, velocity, radius, CellCoord(position.x), CellCoord(position.y)});
+	return m_Agents.size() - 1;
+}
+
+int32_t CrowdSeparation::CellCoord(const float value) { return static_cast<int32_t>(std::floor(value / CELL_SIZE)); }
+
+int CrowdSeparation::Bucket(const int32_t cellX, const int32_t cellY)
+{
+	const uint32_t hash = static_cast<uint32_t>(cellX) * 73856093u ^ static_cast<uint32_t>(cellY) * 19349663u;
+	return static_cast<int>(hash & (BUCKET_COUNT - 1));
+}
+
+void CrowdSeparation::Build()
+{
+	m_BucketStart.fill(0);
+	for (const auto &agent : m_Agents)
+		m_BucketStart[Bucket(agent.cellX, agent.cellY) + 1]++;
+	for (int bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+		m_BucketStart[bucket + 1] += m_BucketStart[bucket];
+
+	std::array<uint32_t, BUCKET_COUNT> cursor;
+	std::copy(m_BucketStart.begin(), m_BucketStart.end() - 1, cursor.begin());
+	m_Sorted.resize(m_Agents.size());
+	for (uint32_t index = 0; index < m_Agents.size(); ++index)
+		m_Sorted[cursor[Bucket(m_Agents[index].cellX, m_Agents[index].cellY)]++] = index;
+}
+
+glm::vec2 CrowdSeparation::Compute(const size_t index) const
+{
+	const Agent &self = m_Agents[index];
+	glm::vec2 push(0.0f);
+
+	for (int32_t dy = -1; dy <= 1; ++dy)
+	{
+		for (int32_t dx = -1; dx <= 1; ++dx)
+		{
+			const int32_t cellX = self.cellX + dx;
+			const int32_t cellY = self.cellY + dy;
+			const int bucket = Bucket(cellX, cellY);
+			for (uint32_t slot = m_BucketStart[bucket]; slot < m_BucketStart[bucket + 1]; ++slot)
+			{
+				const uint32_t otherIndex = m_Sorted[slot];
+				const Agent &other = m_Agents[otherIndex];
+				// 不同格子可能落在同一個桶：只算真的在這格的，也避免重複計算
+				if (otherIndex == index || other.cellX != cellX || other.cellY != cellY)
+					continue;
+
+				// 同一點重疊時沒有方向，用索引決定往哪邊推，兩者才會分開
+				const glm::vec2 tieBreak = (index < otherIndex) ? glm::vec2(1.0f, 0.0f) : glm::vec2(-1.0f, 0.0f);
+				const float combined = self.radius + other.radius;
+
+				// 分離
+				const glm::vec2 offset = self.position - other.position;
+				const float range = combined * PERSONAL_SPACE;
+				const float distanceSq = glm::dot(offset, offset);
+				if (distanceSq < range * range)
+				{
+					const float distance = std::sqrt(distanceSq);
+					const glm::vec2 away = distance > 1e-3f ? offset / distance : tieBreak;
+					push += away * (1.0f - distance / range);
+					continue;
+				}
+
+				// 避讓：相對運動在預測時間內的最近距離小於半徑和就會撞上
+				const glm::vec2 relativePos = other.position - self.position;
+				const glm::vec2 relativeVel = other.velocity - self.velocity;
+				const float speedSq = glm::dot(relativeVel, relativeVel);
+				if (speedSq < 1e-4f)
+					continue;
+				const float time = -glm::dot(relativePos, relativeVel) / speedSq;
+				if (time <= 0.0f || time > AVOID_HORIZON)
+					continue;
+				const glm::vec2 closest = relativePos + relativeVel * time;
+				const float closestSq = glm::dot(closest, closest);
+				if (closestSq >= combined * combined)
+					continue;
+				const float closestDistance = std::sqrt(closestSq);
+				// 正面對撞時最近點在原點，往自己速度的左側讓
+				glm::vec2 sideStep = tieBreak;
+				if (closestDistance > 1e-3f)
+					sideStep = -closest / closestDistance;
+				else if (glm::dot(self.velocity, self.velocity) > 1e-4f)
+					sideStep = glm::normalize(glm::vec2(-self.velocity.y, self.velocity.x));
+				push += sideStep * (1.0f - time / AVOID_HORIZON) * (1.0f - closestDistance / combined);
+			}
+		}
+	}
+
+	const float strength = glm::length(push);
+	if (strength > MAX_STRENGTH)
+		push *= MAX_STRENGTH / strength;
+	return push;
+}
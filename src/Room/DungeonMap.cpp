@@ -3,9 +3,11 @@
 //
 
 #include "Room/DungeonMap.hpp"
+#include <algorithm>
 #include <iostream>
 #include <random>
 #include "Creature/Character.hpp"
+#include "Loader.hpp"
 #include "Room/BossRoom.hpp"
 #include "Room/ChestRoom.hpp"
 #include "Room/DungeonRoom.hpp"
@@ -19,7 +21,65 @@
 #include "Util/Input.hpp"
 #include "Util/Logger.hpp"
 
-void DungeonMap::Start()
+void DungeonMap::Start(const std::shared_ptr<const DungeonPlan> &plan)
+{
+	if (plan)
+	{
+		// 背景執行緒已經規劃好（DungeonMap::GeneratePlan），這裏只剩建房
+		std::copy(plan->rooms.begin(), plan->rooms.end(), std::begin(m_RoomInfo));
+	}
+	else
+	{
+		// 产生了主要路径
+		GenerateMainPath(IsLastStage(CurrentStage()));
+
+		// 生成分支房間
+		GenerateBranches();
+	}
+
+	// 先只建起始房間和它通往的房間，其他房間等玩家走近再建（MaterializeNeighbors）
+	for (int i = 0; i < std::size(m_RoomInfo); ++i)
+	{
+		if (m_RoomInfo[i].m_RoomType != RoomType::STARTING)
+			continue;
+		MaterializeRoom(i);
+		MaterializeNeighbors(i);
+		break;
+	}
+}
+
+std::shared_ptr<const DungeonPlan> DungeonMap::GeneratePlan(const std::string &theme, const int stage)
+{
+	// 在背景執行緒跑：只碰自己的Loader和有鎖的 RoomPrefabCache，不建任何物件、不碰GL
+	const auto loader = std::make_shared<Loader>(theme);
+	DungeonMap map(nullptr, loader, nullptr);
+	map.GenerateMainPath(IsLastStage(stage));
+	map.GenerateBranches();
+
+	auto plan = std::make_shared<DungeonPlan>();
+	plan->theme = theme;
+	plan->stage = stage;
+	for (int i = 0; i < static_cast<int>(plan->rooms.size()); ++i)
+	{
+		plan->rooms[i] = map.m_RoomInfo[i];
+		// 怪物房的佈局是隨機的，先選好並解析；其他房間的佈局固定，建房時直接命中快取
+		if (plan->rooms[i].m_RoomType == RoomType::MONSTER)
+			plan->rooms[i].layout = loader->LoadMonsterRoomObjectPosition_Random();
+	}
+	return plan;
+}
+
+int DungeonMap::CurrentStage()
+{
+	if (SaveManager::GetInstance().HasSaveData())
+	{
+		if (const auto saveData = SaveManager::GetInstance().GetSaveData())
+			return saveData->gameProgress.currentStage;
+	}
+	return 0;
+}
+
+glm::vec2 DungeonMap::GetRoomWorldCoord(const int index) const
 {
 	const float tileSize = m_SpaceInfo.tileSize.x;
 	const float roomRegion = m_SpaceInfo.roomRegion.x;
@@ -28,73 +88,88 @@ void DungeonMap::Start()
 	startPos *= glm::vec2(-1, 1); // 左上0，0房间坐标
 	const float offsetRoom = tileSize * roomRegion;
 
-	// 产生了主要路径
-	GenerateMainPath();
-
-	// 生成分支房間
-	GenerateBranches();
+	const int x = index % static_cast<int>(m_SpaceInfo.roomNum.x);
+	const int y = index / static_cast<int>(m_SpaceInfo.roomNum.x);
+	return startPos + glm::vec2(offsetRoom, -offsetRoom) * glm::vec2(x, y);
+}
 
-	for (int i = 0; i < std::size(m_RoomInfo); ++i)
+std::shared_ptr<DungeonRoom> DungeonMap::MaterializeRoom(const int index)
+{
+	if (index < 0 || index >= static_cast<int>(std::size(m_RoomInfo)))
+		return nullptr;
+	RoomInfo &info = m_RoomInfo[index];
+	if (info.room || info.m_RoomType == RoomType::EMPTY)
+		return info.room;
+
+	const int x = index % static_cast<int>(m_SpaceInfo.roomNum.x);
+	const int y = index / static_cast<int>(m_SpaceInfo.roomNum.x);
+	const glm::vec2 roomPosition = GetRoomWorldCoord(index);
+	std::shared_ptr<DungeonRoom> room;
+
+	switch (info.m_RoomType)
 	{
-		if (m_RoomInfo[i].m_RoomType == RoomType::EMPTY)
-			continue;
+	case RoomType::STARTING:
+		room = std::make_shared<StartingRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
+											  glm::vec2(x, y));
+		break;
+	case RoomType::MONSTER:
+		room = std::make_shared<MonsterRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
+											 glm::vec2(x, y));
+		break;
+	case RoomType::BOSS:
+		room = std::make_shared<BossRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(), glm::vec2(x, y));
+		break;
+	case RoomType::PORTAL:
+		room =
+			std::make_shared<PortalRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(), glm::vec2(x, y));
+		break;
+	case RoomType::CHEST:
+		room = std::make_shared<ShopRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(), glm::vec2(x, y));
+		break;
+	case RoomType::SPECIAL:
+		room = std::make_shared<SpecialRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
+											 glm::vec2(x, y));
+		break;
+	default:
+		break;
+	}
 
-		const int x = i % static_cast<int>(m_SpaceInfo.roomNum.x);
-		const int y = i / static_cast<int>(m_SpaceInfo.roomNum.x);
-		glm::vec2 roomPosition = startPos + glm::vec2(offsetRoom, -offsetRoom) * glm::vec2(x, y);
-		std::shared_ptr<DungeonRoom> room;
+	if (!room)
+		return nullptr;
+	room->SetPlannedLayout(info.layout);
+	room->Start(m_Player.lock());
+	// 注意：不在初始化時就將玩家添加到所有房間
+	// room->PlayerEnter(m_Player.lock());
+	info.room = room;
 
-		switch (m_RoomInfo[i].m_RoomType)
-		{
-		case RoomType::STARTING:
-			room = std::make_shared<StartingRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
-												  glm::vec2(x, y));
-			break;
-		case RoomType::MONSTER:
-			room = std::make_shared<MonsterRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
-												 glm::vec2(x, y));
-			break;
-		case RoomType::BOSS:
-			room =
-				std::make_shared<BossRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(), glm::vec2(x, y));
-			break;
-		case RoomType::PORTAL:
-			room = std::make_shared<PortalRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
-												glm::vec2(x, y));
-			break;
-		case RoomType::CHEST:
-			room =
-				std::make_shared<ShopRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(), glm::vec2(x, y));
-			break;
-		case RoomType::SPECIAL:
-			room = std::make_shared<SpecialRoom>(roomPosition, m_Loader.lock(), m_RoomObjectFactory.lock(),
-												 glm::vec2(x, y));
-			break;
-		default:
-			break;
-		}
+	for (Direction dir : ALL_DIRECTIONS)
+	{
+		if (info.m_Connections[static_cast<int>(dir)])
+			room->CreateCorridorInDirection(dir);
+		else
+			room->CreateWallInDirection(dir);
+	}
 
-		if (!room)
-			continue;
-		room->Start(m_Player.lock());
-		// 注意：不在初始化時就將玩家添加到所有房間
-		// room->PlayerEnter(m_Player.lock());
-		m_RoomInfo[i].room = room;
+	// 在所有地形生成完成後進行最終設置和優化
+	room->FinalizeRoomSetup();
 
-		for (Direction dir : ALL_DIRECTIONS)
-		{
-			if (m_RoomInfo[i].m_Connections[static_cast<int>(dir)])
-				room->CreateCorridorInDirection(dir);
-			else
-				room->CreateWallInDirection(dir);
-		}
+	// 和已經建好的鄰居互相連接
+	SetupRoomConnections(index);
+	return room;
+}
 
-		// 在所有地形生成完成後進行最終設置和優化
-		room->FinalizeRoomSetup();
+void DungeonMap::MaterializeNeighbors(const int index)
+{
+	const glm::ivec2 pos(index % 5, index / 5);
+	for (Direction dir : ALL_DIRECTIONS)
+	{
+		if (!m_RoomInfo[index].m_Connections[static_cast<int>(dir)])
+			continue;
+		const glm::ivec2 next = Move(pos, dir);
+		if (next.x < 0 || next.x >= 5 || next.y < 0 || next.y >= 5)
+			continue;
+		MaterializeRoom(next.y * 5 + next.x);
 	}
-
-	// 設置房間間的連接關係
-	SetupRoomConnections();
 }
 
 void DungeonMap::Update()
@@ -124,7 +199,7 @@ void DungeonMap::Update()
 	}
 }
 
-bool DungeonMap::GenerateMainPath()
+bool DungeonMap::GenerateMainPath(const bool isLastStage)
 {
 	glm::ivec2 start = {2, 2};
 	int startIndex = start.y * 5 + start.x;
@@ -157,17 +232,6 @@ bool DungeonMap::GenerateMainPath()
 	glm::ivec2 finalRoom = Move(monster2, dir3);
 	int finalRoomIndex = finalRoom.y * 5 + finalRoom.x;
 
-	// 檢查當前關卡是否為第5關（最後一關）
-	bool isLastStage = false;
-	if (SaveManager::GetInstance().HasSaveData())
-	{
-		auto saveData = SaveManager::GetInstance().GetSaveData();
-		if (saveData && saveData->gameProgress.currentStage == 5)
-		{
-			isLastStage = true;
-		}
-	}
-
 	// 根據是否為最後一關決定房間類型
 	if (isLastStage)
 	{
@@ -408,10 +472,13 @@ void DungeonMap::UpdateCurrentRoomIfNeeded()
 		}
 
 		// 切換到新房間並添加玩家
-		m_CurrentRoom = m_RoomInfo[IndexInside.y * 5 + IndexInside.x].room;
+		const int index = IndexInside.y * 5 + IndexInside.x;
+		m_CurrentRoom = MaterializeRoom(index);
 		if (m_CurrentRoom)
 		{
 			m_CurrentRoom->PlayerEnter(m_Player.lock());
+			// 玩家能走到的下一間房先建好，走出通道時已經在那裏
+			MaterializeNeighbors(index);
 		}
 	}
 }
@@ -486,48 +553,33 @@ std::optional<Direction> DungeonMap::GetRandomValidDirection(const glm::ivec2 &c
 	return std::nullopt;
 }
 
-void DungeonMap::SetupRoomConnections()
+void DungeonMap::SetupRoomConnections(const int index)
 {
-	for (int i = 0; i < std::size(m_RoomInfo); ++i)
-	{
-		if (m_RoomInfo[i].m_RoomType == RoomType::EMPTY || !m_RoomInfo[i].room)
-			continue;
+	const std::shared_ptr<DungeonRoom> &room = m_RoomInfo[index].room;
+	if (!room)
+		return;
 
-		const int x = i % static_cast<int>(m_SpaceInfo.roomNum.x);
-		const int y = i / static_cast<int>(m_SpaceInfo.roomNum.x);
+	const int x = index % static_cast<int>(m_SpaceInfo.roomNum.x);
+	const int y = index / static_cast<int>(m_SpaceInfo.roomNum.x);
 
-		// 檢查四個方向的相鄰房間
-		for (Direction dir : ALL_DIRECTIONS)
-		{
-			glm::ivec2 neighborPos = glm::ivec2(x, y);
-			switch (dir)
-			{
-			case Direction::UP:
-				neighborPos.y -= 1;
-				break;
-			case Direction::DOWN:
-				neighborPos.y += 1;
-				break;
-			case Direction::LEFT:
-				neighborPos.x -= 1;
-				break;
-			case Direction::RIGHT:
-				neighborPos.x += 1;
-				break;
-			}
+	// 檢查四個方向的相鄰房間
+	for (Direction dir : ALL_DIRECTIONS)
+	{
+		const glm::ivec2 neighborPos = Move(glm::ivec2(x, y), dir);
 
-			// 邊界檢查
-			if (neighborPos.x < 0 || neighborPos.x >= 5 || neighborPos.y < 0 || neighborPos.y >= 5)
-				continue;
+		// 邊界檢查
+		if (neighborPos.x < 0 || neighborPos.x >= 5 || neighborPos.y < 0 || neighborPos.y >= 5)
+			continue;
 
-			int neighborIndex = neighborPos.y * 5 + neighborPos.x;
+		const int neighborIndex = neighborPos.y * 5 + neighborPos.x;
 
-			// 如果相鄰位置有房間，設置連接關係
-			if (m_RoomInfo[neighborIndex].room)
-			{
-				bool hasConnection = m_RoomInfo[i].m_Connections[static_cast<int>(dir)];
-				m_RoomInfo[i].room->SetNeighborRoom(dir, m_RoomInfo[neighborIndex].room, hasConnection);
-			}
+		// 如果相鄰位置已經有房間，雙向設置連接關係
+		if (const auto &neighbor = m_RoomInfo[neighborIndex].room)
+		{
+			const Direction opposite = GetOppositeDirection(dir);
+			room->SetNeighborRoom(dir, neighbor, m_RoomInfo[index].m_Connections[static_cast<int>(dir)]);
+			neighbor->SetNeighborRoom(opposite, room,
+									  m_RoomInfo[neighborIndex].m_Connections[static_cast<int>(opposite)]);
 		}
 	}
 }
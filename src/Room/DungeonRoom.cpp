@@ -5,6 +5,7 @@
 #include "Room/DungeonRoom.hpp"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "Camera.hpp"
 #include "Components/CollisionComponent.hpp"
@@ -15,6 +16,8 @@
 #include "Creature/Character.hpp"
 #include "Factory/RoomObjectFactory.hpp"
 #include "Loader.hpp"
+#include "Room/CollisionOptimizer.hpp"
+#include "Room/RoomPrefabCache.hpp"
 #include "RoomObject/WallObject.hpp"
 #include "Tool/Tool.hpp"
 
@@ -72,16 +75,27 @@ void GridSystem::Initialize()
 	{
 		std::fill(row.begin(), row.end(), 0);
 	}
+	m_Version++;
 }
 
 void GridSystem::MarkPosition(int row, int col, int value)
 {
 	if (IsValidPosition(row, col))
 	{
-		m_Grid[row][col] = value;
+		if (m_Grid[row][col] != value)
+		{
+			m_Grid[row][col] = value;
+			m_Version++;
+		}
 	}
 }
 
+void GridSystem::Assign(const std::vector<std::vector<int>> &grid)
+{
+	m_Grid = grid;
+	m_Version++;
+}
+
 bool GridSystem::IsPositionBlocked(int row, int col) const
 {
 	if (!IsValidPosition(row, col))
@@ -203,6 +217,9 @@ DungeonRoom::DungeonRoom(const glm::vec2 worldCoord, const std::shared_ptr<Loade
 	m_GridSystem = std::make_unique<GridSystem>();
 	m_ConnectionManager = std::make_unique<RoomConnectionManager>();
 	m_TerrainGenerator = std::make_unique<TerrainGenerator>(room_object_factory);
+	m_Pathfinder = std::make_unique<GridPathfinder>();
+	m_FlowField = std::make_unique<GridFlowField>();
+	m_AIScheduler->SetNavigation(m_Pathfinder.get(), m_FlowField.get());
 }
 
 void DungeonRoom::Start(const std::shared_ptr<Character> &player)
@@ -217,6 +234,12 @@ void DungeonRoom::Start(const std::shared_ptr<Character> &player)
 
 void DungeonRoom::Update()
 {
+	// 敵人AI在這之後才更新：先同步網格（排程器的平行階段只讀，不能在那裏同步），再重置尋路額度
+	GridPathfinder *pathfinder = GetPathfinder();
+	pathfinder->BeginFrame();
+	// 玩家換格或網格變動才會真的重算
+	if (const auto player = m_Player.lock())
+		m_FlowField->Update(*pathfinder, player->GetWorldCoord());
 	Room::Update();
 
 	// DebugDungeonRoom();
@@ -224,8 +247,7 @@ void DungeonRoom::Update()
 
 void DungeonRoom::LoadFromJSON()
 {
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadStartingRoomObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadStartingRoomObjectPosition());
 }
 
 void DungeonRoom::SetState(RoomState newState)
@@ -357,6 +379,12 @@ const std::vector<std::vector<int>> &DungeonRoom::GetGridData() const { return m
 
 bool DungeonRoom::IsGridPositionBlocked(int row, int col) const { return m_GridSystem->IsPositionBlocked(row, col); }
 
+GridPathfinder *DungeonRoom::GetPathfinder()
+{
+	m_Pathfinder->SyncWith(*m_GridSystem, m_RoomSpaceInfo);
+	return m_Pathfinder.get();
+}
+
 void DungeonRoom::InitializeGrid()
 {
 	m_GridSystem->Initialize();
@@ -369,6 +397,7 @@ void DungeonRoom::CreateWall(int row, int col)
 	if (auto wall = m_TerrainGenerator->CreateWall(row, col, m_RoomSpaceInfo))
 	{
 		AddRoomObject(wall);
+		m_LayoutObjects.push_back(wall);
 		m_GridSystem->MarkPosition(row, col, 1);
 	}
 }
@@ -378,6 +407,7 @@ void DungeonRoom::CreateFloor(int row, int col)
 	if (auto floor = m_TerrainGenerator->CreateFloor(row, col, m_RoomSpaceInfo))
 	{
 		AddRoomObject(floor);
+		m_LayoutObjects.push_back(floor);
 	}
 }
 
@@ -386,6 +416,7 @@ void DungeonRoom::CreateDoor(int row, int col)
 	if (auto door = m_TerrainGenerator->CreateDoor(row, col, m_RoomSpaceInfo))
 	{
 		AddRoomObject(door);
+		m_LayoutObjects.push_back(door);
 		m_Doors.emplace_back(door);
 		m_GridSystem->MarkPosition(row, col, 1);
 	}
@@ -393,6 +424,7 @@ void DungeonRoom::CreateDoor(int row, int col)
 
 void DungeonRoom::CreateCorridorInDirection(Direction dir)
 {
+	m_CorridorMask |= static_cast<uint8_t>(1u << static_cast<int>(dir));
 	const glm::vec2 center = m_RoomSpaceInfo.m_RoomRegion / 2.0f;
 	const glm::vec2 roomSize = m_RoomSpaceInfo.m_RoomSize;
 
@@ -551,9 +583,59 @@ void DungeonRoom::DebugDungeonRoom()
 
 void DungeonRoom::FinalizeRoomSetup()
 {
-	// 重新初始化網格以包含所有新創建的物件
-	InitializeGrid();
+	const uint8_t corridorMask = m_CorridorMask;
+	m_CorridorMask = 0;
+	if (!m_LayoutPrefab)
+	{
+		// 沒有佈局預製件（佈局讀取失敗）：照舊逐物件重算
+		InitializeGrid();
+		OptimizeWallCollisions();
+		return;
+	}
 
-	// 在所有牆壁和通道創建完成後進行碰撞優化
-	OptimizeWallCollisions();
+	// 同佈局同通道組合只有第一間房需要算，之後的房間平移套用
+	auto &cache = RoomPrefabCache::GetInstance();
+	auto terrain = cache.FindTerrain(*m_LayoutPrefab, corridorMask);
+	if (!terrain)
+		terrain = cache.StoreTerrain(*m_LayoutPrefab, corridorMask, BuildTerrainPrefab());
+	ApplyTerrainPrefab(*terrain);
+}
+
+RoomTerrainPrefab DungeonRoom::BuildTerrainPrefab() const
+{
+	RoomTerrainPrefab terrain;
+
+	GridSystem grid;
+	grid.UpdateGridFromObjects(m_LayoutObjects, m_RoomSpaceInfo);
+	terrain.grid = grid.GetGrid();
+
+	CollisionOptimizer optimizer;
+	terrain.colliders = optimizer.OptimizeWallCollisions(m_LayoutObjects, m_RoomSpaceInfo.m_TileSize,
+														 m_RoomSpaceInfo.m_WorldCoord, RoomConstants::GRID_SIZE);
+	for (auto &collider : terrain.colliders)
+		collider.worldPos -= m_RoomSpaceInfo.m_WorldCoord;
+	return terrain;
+}
+
+void DungeonRoom::ApplyTerrainPrefab(const RoomTerrainPrefab &terrain)
+{
+	// 網格：預製件 + 佈局以外的物件（傳送門、寶箱、商店桌…）
+	m_GridSystem->Assign(terrain.grid);
+	std::unordered_set<const nGameObject *> layoutObjects;
+	layoutObjects.reserve(m_LayoutObjects.size());
+	for (const auto &object : m_LayoutObjects)
+		layoutObjects.insert(object.get());
+	std::vector<std::shared_ptr<nGameObject>> extraObjects;
+	for (const auto &object : m_RoomObjects)
+		if (!layoutObjects.count(object.get()))
+			extraObjects.push_back(object);
+	m_GridSystem->UpdateGridFromObjects(extraObjects, m_RoomSpaceInfo);
+
+	// 牆壁碰撞：拔掉每塊牆各自的碰撞箱，換成合併後的碰撞箱
+	RemoveWallCollisionComponents();
+	std::vector<CollisionRect> regions = terrain.colliders;
+	for (auto &region : regions)
+		region.worldPos += m_RoomSpaceInfo.m_WorldCoord;
+	for (auto &collider : CreateOptimizedColliders(regions))
+		AddRoomObject(collider);
 }
@@ -0,0 +1,159 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Room/GridFlowField.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "glm/geometric.hpp"
+
+namespace
+{
+	constexpr float SQRT2 = 1.41421356f;
+	constexpr float INF = std::numeric_limits<float>::max();
+} // namespace
+
+GridFlowField::GridFlowField() { m_Heap.reserve(CELL_COUNT * 2); }
+
+void GridFlowField::Update(const GridPathfinder &grid, const glm::vec2 &targetPos)
+{
+	const glm::ivec2 targetCell = grid.WorldToGrid(targetPos);
+	if (m_Valid && m_Grid == &grid && targetCell == m_TargetCell && m_GridVersion == grid.GetGridVersion())
+		return;
+
+	m_Grid = &grid;
+	m_TargetCell = targetCell;
+	m_GridVersion = grid.GetGridVersion();
+	Rebuild(grid, targetPos);
+}
+
+void GridFlowField::Rebuild(const GridPathfinder &grid, const glm::vec2 &targetPos)
+{
+	m_Cost.fill(INF);
+	m_Flags.fill(0);
+	m_Valid = false;
+
+	// 玩家貼牆時所在格子可能被標成擋住，從最近的空格開始展開
+	glm::ivec2 seed = m_TargetCell;
+	if (!grid.FindNearestWalkable(seed))
+		return;
+
+	const auto walkable = [&grid](const int col, const int row) { return !grid.IsBlocked(row, col); };
+	const auto cmp = [](const HeapEntry &a, const HeapEntry &b) { return a.cost > b.cost; };
+
+	// Dijkstra：由目標往外算到每格的距離
+	m_Heap.clear();
+	const int seedIndex = seed.y * GRID_SIZE + seed.x;
+	m_Cost[seedIndex] = 0.0f;
+	m_Heap.push_back({0.0f, static_cast<int16_t>(seedIndex)});
+	while (!m_Heap.empty())
+	{
+		std::pop_heap(m_Heap.begin(), m_Heap.end(), cmp);
+		const HeapEntry current = m_Heap.back();
+		m_Heap.pop_back();
+		if (current.cost > m_Cost[current.index])
+			continue;
+
+		const int col = current.index % GRID_SIZE;
+		const int row = current.index / GRID_SIZE;
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				if ((dx == 0 && dy == 0) || !walkable(col + dx, row + dy))
+					continue;
+				const bool diagonal = dx != 0 && dy != 0;
+				if (diagonal && (!walkable(col + dx, row) || !walkable(col, row + dy)))
+					continue;
+
+				const int next = (row + dy) * GRID_SIZE + (col + dx);
+				const float cost = current.cost + (diagonal ? SQRT2 : 1.0f);
+				if (cost < m_Cost[next])
+				{
+					m_Cost[next] = cost;
+					m_Heap.push_back({cost, static_cast<int16_t>(next)});
+					std::push_heap(m_Heap.begin(), m_Heap.end(), cmp);
+				}
+			}
+		}
+	}
+
+	// 每格往代價最低的鄰格走；看得到目標的格子標記起來，取樣時直接直線
+	for (int index = 0; index < CELL_COUNT; ++index)
+	{
+		if (m_Cost[index] == INF)
+			continue;
+		m_Flags[index] = REACHABLE;
+
+		const int col = index % GRID_SIZE;
+		const int row = index / GRID_SIZE;
+		if (grid.HasLineOfSight(grid.GridToWorld({col, row}), targetPos))
+			m_Flags[index] |= VISIBLE;
+
+		float best = m_Cost[index];
+		glm::ivec2 bestStep(0);
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				if ((dx == 0 && dy == 0) || !walkable(col + dx, row + dy))
+					continue;
+				const bool diagonal = dx != 0 && dy != 0;
+				if (diagonal && (!walkable(col + dx, row) || !walkable(col, row + dy)))
+					continue;
+				const float cost = m_Cost[(row + dy) * GRID_SIZE + (col + dx)];
+				if (cost < best)
+				{
+					best = cost;
+					bestStep = {dx, dy};
+				}
+			}
+		}
+		// 網格的row往下增加，世界座標y往上
+		const glm::vec2 step(static_cast<float>(bestStep.x), -static_cast<float>(bestStep.y));
+		m_Direction[index] = (bestStep == glm::ivec2(0)) ? glm::vec2(0.0f) : glm::normalize(step);
+	}
+
+	m_Valid = true;
+	m_RebuildCount++;
+}
+
+bool GridFlowField::Sample(const glm::vec2 &worldPos, const glm::vec2 &targetPos, glm::vec2 &outDirection) const
+{
+	if (!m_Valid || !m_Grid || m_Grid->WorldToGrid(targetPos) != m_TargetCell)
+		return false;
+
+	const glm::ivec2 cell = m_Grid->WorldToGrid(worldPos);
+	if (cell.x < 0 || cell.x >= GRID_SIZE || cell.y < 0 || cell.y >= GRID_SIZE)
+		return false;
+
+	const int index = cell.y * GRID_SIZE + cell.x;
+	if (!(m_Flags[index] & REACHABLE))
+		return false;
+
+	const glm::vec2 toTarget = targetPos - worldPos;
+	if (glm::dot(toTarget, toTarget) < 1e-6f)
+		return false;
+	const glm::vec2 direct = glm::normalize(toTarget);
+	if (m_Direction[index] == glm::vec2(0.0f))
+	{
+		outDirection = direct;
+		return true;
+	}
+
+	// 可視是以格子中心算的；角色偏離中心時，直線前方一格若擋住就改走流場方向
+	if (m_Flags[index] & VISIBLE)
+	{
+		const glm::ivec2 ahead = m_Grid->WorldToGrid(worldPos + direct * m_Grid->GetTileSize() * 0.75f);
+		if (ahead == cell || (!m_Grid->IsBlocked(ahead.y, ahead.x) && !m_Grid->IsBlocked(cell.y, ahead.x) &&
+							   !m_Grid->IsBlocked(ahead.y, cell.x)))
+		{
+			outDirection = direct;
+			return true;
+		}
+	}
+	outDirection = m_Direction[index];
+	return true;
+}
@@ -0,0 +1,453 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Room/GridPathfinder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "RandomUtil.hpp"
+#include "Room/DungeonRoom.hpp"
+#include "Util/Time.hpp"
+#include "glm/common.hpp"
+#include "glm/geometric.hpp"
+
+static_assert(GridPathfinder::GRID_SIZE == RoomConstants::GRID_SIZE, "GridPathfinder 必須與房間網格大小一致");
+static_assert(GridPathfinder::GRID_SIZE <= 64, "每列要塞進一個uint64_t");
+
+namespace
+{
+	constexpr float SQRT2 = 1.41421356f;
+	constexpr float INF = std::numeric_limits<float>::max();
+
+	// 八方向距離（直走1，斜走√2）
+	float Octile(const int dx, const int dy)
+	{
+		const int ax = std::abs(dx);
+		const int ay = std::abs(dy);
+		return static_cast<float>(std::max(ax, ay)) + (SQRT2 - 1.0f) * static_cast<float>(std::min(ax, ay));
+	}
+
+	int Sign(const int v) { return (v > 0) - (v < 0); }
+} // namespace
+
+// ===== GridPathfinder 實現 =====
+GridPathfinder::GridPathfinder() { m_Open.reserve(CELL_COUNT); }
+
+void GridPathfinder::SyncWith(const GridSystem &grid, const RoomSpaceInfo &spaceInfo)
+{
+	if (m_HasSynced && m_SyncedVersion == grid.GetVersion())
+		return;
+
+	const auto &cells = grid.GetGrid();
+	for (int row = 0; row < GRID_SIZE; ++row)
+	{
+		uint64_t bits = 0;
+		for (int col = 0; col < GRID_SIZE; ++col)
+		{
+			if (cells[row][col] != 0)
+				bits |= 1ULL << col;
+		}
+		m_Blocked[row] = bits;
+	}
+
+	// 與 GridSystem::UpdateGridFromObjects 相同的左上角格子中心
+	m_TileSize = spaceInfo.m_TileSize.x;
+	m_Origin = glm::vec2(spaceInfo.m_RoomRegion.x * m_TileSize / 2.0f) - glm::vec2(m_TileSize / 2.0f);
+	m_Origin *= glm::vec2(-1, 1);
+	m_Origin += spaceInfo.m_WorldCoord;
+
+	m_SyncedVersion = grid.GetVersion();
+	m_HasSynced = true;
+}
+
+void GridPathfinder::BeginFrame()
+{
+	m_QueriesThisFrame = 0;
+	m_DeferredThisFrame = 0;
+}
+
+bool GridPathfinder::IsBlocked(const int row, const int col) const { return !IsWalkable(col, row); }
+
+glm::ivec2 GridPathfinder::WorldToGrid(const glm::vec2 &worldPos) const
+{
+	// 格子以m_Origin + index * tile為中心，所以要四捨五入而不是直接floor
+	const float x = (worldPos.x - m_Origin.x) / m_TileSize;
+	const float y = (m_Origin.y - worldPos.y) / m_TileSize;
+	return {static_cast<int>(std::floor(x + 0.5f)), static_cast<int>(std::floor(y + 0.5f))};
+}
+
+glm::vec2 GridPathfinder::GridToWorld(const glm::ivec2 &grid) const
+{
+	return m_Origin + glm::vec2(static_cast<float>(grid.x) * m_TileSize, -static_cast<float>(grid.y) * m_TileSize);
+}
+
+bool GridPathfinder::FindNearestWalkable(glm::ivec2 &cell) const
+{
+	cell = glm::clamp(cell, glm::ivec2(0), glm::ivec2(GRID_SIZE - 1));
+	if (IsWalkable(cell.x, cell.y))
+		return true;
+
+	// 角色常常貼著障礙物，所在格子被標記成擋住；往外找兩圈
+	for (int radius = 1; radius <= 2; ++radius)
+	{
+		for (int dy = -radius; dy <= radius; ++dy)
+		{
+			for (int dx = -radius; dx <= radius; ++dx)
+			{
+				if (std::max(std::abs(dx), std::abs(dy)) != radius)
+					continue;
+				if (IsWalkable(cell.x + dx, cell.y + dy))
+				{
+					cell += glm::ivec2(dx, dy);
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+GridPathfinder::PathResult GridPathfinder::FindPath(const glm::vec2 &from, const glm::vec2 &to,
+													std::vector<glm::vec2> &outWaypoints)
+{
+	glm::ivec2 start = WorldToGrid(from);
+	glm::ivec2 goal = WorldToGrid(to);
+	if (!FindNearestWalkable(start) || !FindNearestWalkable(goal))
+	{
+		outWaypoints.clear();
+		return PathResult::NOT_FOUND;
+	}
+	if (start == goal)
+	{
+		outWaypoints.clear();
+		return PathResult::FOUND;
+	}
+
+	if (!HasBudget())
+	{
+		m_DeferredThisFrame++;
+		return PathResult::BUDGET_EXCEEDED;
+	}
+	m_QueriesThisFrame++;
+
+	// 新世代：舊的g值/關閉標記全部自動失效
+	if (++m_Generation == 0)
+	{
+		m_Stamp.fill(0);
+		m_Generation = 1;
+	}
+	m_Open.clear();
+
+	const int startIndex = start.y * GRID_SIZE + start.x;
+	m_GoalIndex = goal.y * GRID_SIZE + goal.x;
+	PushOpen(startIndex, 0.0f, -1);
+
+	const auto cmp = [](const OpenEntry &a, const OpenEntry &b) { return a.f > b.f; };
+	while (!m_Open.empty())
+	{
+		std::pop_heap(m_Open.begin(), m_Open.end(), cmp);
+		const int current = m_Open.back().index;
+		m_Open.pop_back();
+
+		if (m_Closed[current])
+			continue;
+		m_Closed[current] = 1;
+
+		if (current == m_GoalIndex)
+		{
+			BuildPath(current, outWaypoints);
+			return PathResult::FOUND;
+		}
+		IdentifySuccessors(current);
+	}
+
+	outWaypoints.clear();
+	return PathResult::NOT_FOUND;
+}
+
+void GridPathfinder::PushOpen(const int index, const float g, const int parent)
+{
+	if (m_Stamp[index] != m_Generation)
+	{
+		m_Stamp[index] = m_Generation;
+		m_G[index] = INF;
+		m_Closed[index] = 0;
+	}
+	if (m_Closed[index] || g >= m_G[index])
+		return;
+
+	m_G[index] = g;
+	m_Parent[index] = static_cast<int16_t>(parent);
+
+	const int col = index % GRID_SIZE;
+	const int row = index / GRID_SIZE;
+	const float h = Octile(m_GoalIndex % GRID_SIZE - col, m_GoalIndex / GRID_SIZE - row);
+	m_Open.push_back({g + h, static_cast<int16_t>(index)});
+	std::push_heap(m_Open.begin(), m_Open.end(), [](const OpenEntry &a, const OpenEntry &b) { return a.f > b.f; });
+}
+
+int GridPathfinder::Jump(int col, int row, const int dx, const int dy) const
+{
+	while (true)
+	{
+		if (!IsWalkable(col, row))
+			return -1;
+		const int index = row * GRID_SIZE + col;
+		if (index == m_GoalIndex)
+			return index;
+
+		if (dx != 0 && dy != 0)
+		{
+			// 斜走：任一直向能找到跳點，這裏就是跳點
+			if (Jump(col + dx, row, dx, 0) != -1 || Jump(col, row + dy, 0, dy) != -1)
+				return index;
+			// 不切牆角：兩側都空才能繼續斜走
+			if (!IsWalkable(col + dx, row) || !IsWalkable(col, row + dy))
+				return -1;
+		}
+		else if (dx != 0)
+		{
+			if ((IsWalkable(col, row - 1) && !IsWalkable(col - dx, row - 1)) ||
+				(IsWalkable(col, row + 1) && !IsWalkable(col - dx, row + 1)))
+				return index;
+		}
+		else
+		{
+			if ((IsWalkable(col - 1, row) && !IsWalkable(col - 1, row - dy)) ||
+				(IsWalkable(col + 1, row) && !IsWalkable(col + 1, row - dy)))
+				return index;
+		}
+		col += dx;
+		row += dy;
+	}
+}
+
+void GridPathfinder::IdentifySuccessors(const int index)
+{
+	const int col = index % GRID_SIZE;
+	const int row = index / GRID_SIZE;
+
+	// 依來的方向剪枝，最多八個方向
+	std::array<glm::ivec2, 8> dirs;
+	int count = 0;
+	const auto add = [&](const int dx, const int dy) { dirs[count++] = {dx, dy}; };
+
+	const int parent = m_Parent[index];
+	if (parent < 0)
+	{
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				if (dx == 0 && dy == 0)
+					continue;
+				if (dx != 0 && dy != 0 && (!IsWalkable(col + dx, row) || !IsWalkable(col, row + dy)))
+					continue;
+				if (IsWalkable(col + dx, row + dy))
+					add(dx, dy);
+			}
+		}
+	}
+	else
+	{
+		const int dx = Sign(col - parent % GRID_SIZE);
+		const int dy = Sign(row - parent / GRID_SIZE);
+		if (dx != 0 && dy != 0)
+		{
+			const bool vertical = IsWalkable(col, row + dy);
+			const bool horizontal = IsWalkable(col + dx, row);
+			if (vertical)
+				add(0, dy);
+			if (horizontal)
+				add(dx, 0);
+			if (vertical && horizontal)
+				add(dx, dy);
+		}
+		else if (dx != 0)
+		{
+			const bool next = IsWalkable(col + dx, row);
+			const bool down = IsWalkable(col, row + 1);
+			const bool up = IsWalkable(col, row - 1);
+			if (next)
+			{
+				add(dx, 0);
+				if (down)
+					add(dx, 1);
+				if (up)
+					add(dx, -1);
+			}
+			if (down)
+				add(0, 1);
+			if (up)
+				add(0, -1);
+		}
+		else
+		{
+			const bool next = IsWalkable(col, row + dy);
+			const bool right = IsWalkable(col + 1, row);
+			const bool left = IsWalkable(col - 1, row);
+			if (next)
+			{
+				add(0, dy);
+				if (right)
+					add(1, dy);
+				if (left)
+					add(-1, dy);
+			}
+			if (right)
+				add(1, 0);
+			if (left)
+				add(-1, 0);
+		}
+	}
+
+	const float g = m_G[index];
+	for (int i = 0; i < count; ++i)
+	{
+		const int jumpPoint = Jump(col + dirs[i].x, row + dirs[i].y, dirs[i].x, dirs[i].y);
+		if (jumpPoint < 0)
+			continue;
+		const float cost = Octile(jumpPoint % GRID_SIZE - col, jumpPoint / GRID_SIZE - row);
+		PushOpen(jumpPoint, g + cost, index);
+	}
+}
+
+void GridPathfinder::BuildPath(const int goalIndex, std::vector<glm::vec2> &outWaypoints) const
+{
+	// 先數長度再倒著填，避免reverse
+	size_t length = 0;
+	for (int i = goalIndex; m_Parent[i] >= 0; i = m_Parent[i])
+		++length;
+
+	outWaypoints.resize(length);
+	size_t slot = length;
+	for (int i = goalIndex; m_Parent[i] >= 0; i = m_Parent[i])
+		outWaypoints[--slot] = GridToWorld({i % GRID_SIZE, i / GRID_SIZE});
+}
+
+bool GridPathfinder::HasLineOfSight(const glm::vec2 &from, const glm::vec2 &to) const
+{
+	// 換算成格子空間（格子col涵蓋[col, col+1)），再用DDA走訪線段經過的每一格
+	const float x0 = (from.x - m_Origin.x) / m_TileSize + 0.5f;
+	const float y0 = (m_Origin.y - from.y) / m_TileSize + 0.5f;
+	const float x1 = (to.x - m_Origin.x) / m_TileSize + 0.5f;
+	const float y1 = (m_Origin.y - to.y) / m_TileSize + 0.5f;
+
+	int col = static_cast<int>(std::floor(x0));
+	int row = static_cast<int>(std::floor(y0));
+	const int endCol = static_cast<int>(std::floor(x1));
+	const int endRow = static_cast<int>(std::floor(y1));
+
+	const float dx = x1 - x0;
+	const float dy = y1 - y0;
+	const int stepX = dx > 0 ? 1 : -1;
+	const int stepY = dy > 0 ? 1 : -1;
+	const float tDeltaX = dx != 0.0f ? std::abs(1.0f / dx) : INF;
+	const float tDeltaY = dy != 0.0f ? std::abs(1.0f / dy) : INF;
+	float tMaxX = dx != 0.0f ? (stepX > 0 ? (static_cast<float>(col) + 1.0f - x0) : (x0 - static_cast<float>(col))) * tDeltaX : INF;
+	float tMaxY = dy != 0.0f ? (stepY > 0 ? (static_cast<float>(row) + 1.0f - y0) : (y0 - static_cast<float>(row))) * tDeltaY : INF;
+
+	// 起點、終點所在格子不檢查（角色貼牆時自己的格子可能被標成擋住）
+	for (int guard = 0; guard < GRID_SIZE * 4 && (col != endCol || row != endRow); ++guard)
+	{
+		if (std::abs(tMaxX - tMaxY) < 1e-5f)
+		{
+			// 剛好穿過格子角：兩側都要空，與尋路不切牆角一致
+			if (!IsWalkable(col + stepX, row) || !IsWalkable(col, row + stepY))
+				return false;
+			col += stepX;
+			row += stepY;
+			tMaxX += tDeltaX;
+			tMaxY += tDeltaY;
+		}
+		else if (tMaxX < tMaxY)
+		{
+			col += stepX;
+			tMaxX += tDeltaX;
+		}
+		else
+		{
+			row += stepY;
+			tMaxY += tDeltaY;
+		}
+
+		if ((col != endCol || row != endRow) && !IsWalkable(col, row))
+			return false;
+	}
+	return true;
+}
+
+// ===== PathFollower 實現 =====
+void PathFollower::Reset()
+{
+	m_Waypoints.clear();
+	m_NextWaypoint = 0;
+	m_GoalCell = glm::ivec2(-1);
+	m_RepathTimer = 0.0f;
+	m_Owner = nullptr;
+}
+
+glm::vec2 PathFollower::Steer(GridPathfinder &pathfinder, const glm::vec2 &position, const glm::vec2 &goal)
+{
+	if (m_Owner != &pathfinder)
+	{
+		Reset();
+		m_Owner = &pathfinder;
+	}
+
+	const glm::vec2 toGoal = goal - position;
+	if (glm::dot(toGoal, toGoal) < 1e-6f)
+		return glm::vec2(0.0f);
+
+	// 看得到目標：直線走，不耗查詢額度
+	if (pathfinder.HasLineOfSight(position, goal))
+	{
+		m_Waypoints.clear();
+		m_NextWaypoint = 0;
+		return glm::normalize(toGoal);
+	}
+
+	m_RepathTimer -= Util::Time::GetDeltaTimeMs() / 1000.0f;
+	const glm::ivec2 goalCell = pathfinder.WorldToGrid(goal);
+	// 走完路徑或查不到路時也要等計時，免得每幀都去吃額度
+	const bool exhausted = m_NextWaypoint >= m_Waypoints.size() && m_RepathTimer <= 0.0f;
+	const bool gridChanged = m_GridVersion != pathfinder.GetGridVersion();
+	const bool goalMoved = goalCell != m_GoalCell && m_RepathTimer <= 0.0f;
+
+	if (exhausted || gridChanged || goalMoved)
+	{
+		switch (pathfinder.FindPath(position, goal, m_Waypoints))
+		{
+		case GridPathfinder::PathResult::FOUND:
+		case GridPathfinder::PathResult::NOT_FOUND:
+			m_NextWaypoint = 0;
+			m_GoalCell = goalCell;
+			m_GridVersion = pathfinder.GetGridVersion();
+			// 錯開重算時間，避免一群敵人同一幀一起重查
+			m_RepathTimer = REPATH_INTERVAL * RandomUtil::RandomFloatInRange(0.75f, 1.25f);
+			break;
+		case GridPathfinder::PathResult::BUDGET_EXCEEDED:
+			// 本幀額度用完：沿用舊路徑，下一幀再試
+			break;
+		}
+	}
+
+	const float reachDistance = pathfinder.GetTileSize() * 0.5f;
+	while (m_NextWaypoint < m_Waypoints.size() && glm::distance(position, m_Waypoints[m_NextWaypoint]) < reachDistance)
+		++m_NextWaypoint;
+
+	// 下一個跳點已經看得到就直接切過去，每幀最多多檢查一次
+	if (m_NextWaypoint + 1 < m_Waypoints.size() && pathfinder.HasLineOfSight(position, m_Waypoints[m_NextWaypoint + 1]))
+		++m_NextWaypoint;
+
+	if (m_NextWaypoint < m_Waypoints.size())
+	{
+		const glm::vec2 toWaypoint = m_Waypoints[m_NextWaypoint] - position;
+		if (glm::dot(toWaypoint, toWaypoint) > 1e-6f)
+			return glm::normalize(toWaypoint);
+	}
+	return glm::normalize(toGoal);
+}
@@ -65,8 +65,7 @@ void LobbyRoom::OnCharacterExit(const std::shared_ptr<Character> &character)
 
 void LobbyRoom::LoadFromJSON()
 {
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadLobbyObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadLobbyObjectPosition());
 }
 
 
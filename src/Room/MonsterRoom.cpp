@@ -5,12 +5,14 @@
 #include "Room/MonsterRoom.hpp"
 #include <algorithm>
 #include <random>
+#include <utility>
 #include "Components/AttackComponent.hpp"
 #include "Components/DoorComponent.hpp"
 #include "Creature/Character.hpp"
 #include "Factory/CharacterFactory.hpp"
 #include "Loader.hpp"
 #include "Override/nGameObject.hpp"
+#include "Room/SpawnAreaTable.hpp"
 #include "Scene/SceneManager.hpp"
 #include "Tool/Tool.hpp"
 #include "Util/Input.hpp"
@@ -47,16 +49,20 @@ void MonsterRoom::Update()
 
 void MonsterRoom::LoadFromJSON()
 {
+	// 背景規劃時已經選好佈局就用它（只用一次，之後換佈局照常隨機）
+	if (m_PlannedLayout)
+	{
+		InitializeRoomObjects(std::exchange(m_PlannedLayout, nullptr));
+		return;
+	}
 	// 使用隨機佈局載入
-	const nlohmann::json jsonData = m_Loader.lock()->LoadMonsterRoomObjectPosition_Random();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadMonsterRoomObjectPosition_Random());
 }
 
 void MonsterRoom::LoadFromJSON_Specific(const std::string &layoutName)
 {
 	// 使用指定佈局載入（測試用）
-	const nlohmann::json jsonData = m_Loader.lock()->LoadMonsterRoomObjectPosition_Specific(layoutName);
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadMonsterRoomObjectPosition_Specific(layoutName));
 }
 
 void MonsterRoom::ChangeLayoutRuntime(const std::string &layoutName)
@@ -414,8 +420,10 @@ void MonsterRoom::PreSpawnAllWaveEnemies()
 	// ===== 重新計算所有碰撞物件佔據的格子 =====
 	RecalculateGridFromCollisionComponents();
 
-	// 改進的算法：為每個怪物單獨生成適合其體型的位置
-	std::vector<glm::ivec2> occupiedPositions; // 追蹤已佔用的網格位置
+	// 房間網格建一次前綴和表，之後每隻怪物的放置檢查都是O(1)，放下後增量更新
+	SpawnAreaTable spawnTable;
+	spawnTable.Build(GetGridData());
+	std::mt19937 rng(std::random_device{}());
 
 	// ===== 調試：輸出當前網格狀態 =====
 	LOG_DEBUG("=== PreSpawnAllWaveEnemies Debug Info ===");
@@ -424,19 +432,10 @@ void MonsterRoom::PreSpawnAllWaveEnemies()
 	LOG_DEBUG("Tile Size: ({:.1f}, {:.1f})", m_RoomSpaceInfo.m_TileSize.x, m_RoomSpaceInfo.m_TileSize.y);
 
 	// 統計被阻擋的網格數量
-	const auto &gridData = GetGridData();
-	int blockedCount = 0;
-	int totalCount = gridData.size() * gridData[0].size();
-	for (const auto &row : gridData)
-	{
-		for (int cell : row)
-		{
-			if (cell != 0)
-				blockedCount++;
-		}
-	}
+	const int totalCount = spawnTable.GetWidth() * spawnTable.GetHeight();
+	const int blockedCount = spawnTable.CountBlocked();
 	LOG_DEBUG("Grid Status: {}/{} positions blocked ({:.1f}%)", blockedCount, totalCount,
-			  (float)blockedCount / totalCount * 100.0f);
+			  totalCount > 0 ? (float)blockedCount / totalCount * 100.0f : 0.0f);
 
 	// 為每個波次生成怪物
 	for (size_t waveIndex = 0; waveIndex < m_WaveConfigs.size(); ++waveIndex)
@@ -451,93 +450,25 @@ void MonsterRoom::PreSpawnAllWaveEnemies()
 		{
 			int enemyType = config.enemyTypes[enemyIndex];
 
-			// 首先創建怪物以獲取其體型信息
-			auto tempEnemy = CharacterFactory::GetInstance().createEnemy(enemyType);
-			if (!tempEnemy)
-			{
-				LOG_ERROR("Failed to create enemy type {} for size checking", enemyType);
-				continue;
-			}
-
-			// 獲取怪物的實際體型
-			glm::vec2 enemySize(16.0f, 16.0f); // 預設大小
-			if (auto collisionComp = tempEnemy->GetComponent<CollisionComponent>(ComponentType::COLLISION))
-			{
-				enemySize = collisionComp->GetSize();
-			}
+			// 怪物體型取自工廠快取的類型資料，不需要先建出怪物
+			const glm::vec2 enemySize = CharacterFactory::GetInstance().GetEnemyCollisionSize(enemyType);
 
 			LOG_DEBUG("Enemy {} (Type {}): Size = ({:.1f}, {:.1f})", enemyIndex + 1, enemyType, enemySize.x,
 					  enemySize.y);
 
-			// 生成適合該體型的位置（避開已佔用位置）
-			auto availablePositions = GenerateSpawnPositionsWithSizeAndExclusions(1, enemySize, occupiedPositions);
+			// 生成適合該體型的位置（前面放下的怪物已經寫進表裏）
+			auto availablePositions = ClaimSpawnPositions(1, enemySize, spawnTable, rng);
 
 			if (availablePositions.empty())
 			{
 				LOG_WARN("No available position for enemy type {} with size {}x{}", enemyType, enemySize.x,
 						 enemySize.y);
-
-				// ===== 詳細調試：檢查為什麼沒有可用位置 =====
-				LOG_DEBUG("Debug: Checking available positions for enemy type {}", enemyType);
-				const glm::vec2 &tileSize = m_RoomSpaceInfo.m_TileSize;
-				const glm::vec2 &roomSize = m_RoomSpaceInfo.m_RoomSize;
-				const glm::vec2 &region = m_RoomSpaceInfo.m_RoomRegion;
-
-				const int regionWidth = static_cast<int>(region.x);
-				const int regionHeight = static_cast<int>(region.y);
-				const int roomWidth = static_cast<int>(roomSize.x);
-				const int roomHeight = static_cast<int>(roomSize.y);
-
-				const int entityGridWidth = static_cast<int>(std::ceil(enemySize.x / tileSize.x));
-				const int entityGridHeight = static_cast<int>(std::ceil(enemySize.y / tileSize.y));
-
-				const int centerX = regionWidth / 2;
-				const int centerY = regionHeight / 2;
-				const int startX = centerX - roomWidth / 2 + 1;
-				const int startY = centerY - roomHeight / 2 + 1;
-				const int endX = centerX + roomWidth / 2 - 1 - (entityGridWidth - 1);
-				const int endY = centerY + roomHeight / 2 - 1 - (entityGridHeight - 1);
-
-				LOG_DEBUG("Search area: X=[{}, {}), Y=[{}, {})", startX, endX, startY, endY);
-				LOG_DEBUG("Entity grid size: {}x{}", entityGridWidth, entityGridHeight);
-
-				// 檢查前幾個位置為什麼被阻擋
-				int checkedPositions = 0;
-				for (int row = startY; row < endY && checkedPositions < 5; ++row)
-				{
-					for (int col = startX; col < endX && checkedPositions < 5; ++col)
-					{
-						checkedPositions++;
-						bool isClear = IsAreaClearForEntity({col, row}, entityGridWidth, entityGridHeight);
-						LOG_DEBUG("Position ({}, {}) -> {}", col, row, isClear ? "CLEAR" : "BLOCKED");
-
-						if (!isClear)
-						{
-							// 詳細檢查哪個網格被阻擋
-							for (int r = row; r < row + entityGridHeight; ++r)
-							{
-								for (int c = col; c < col + entityGridWidth; ++c)
-								{
-									bool blocked = IsGridPositionBlocked(r, c);
-									if (blocked)
-									{
-										LOG_DEBUG("  -> Grid ({}, {}) is BLOCKED", c, r);
-									}
-								}
-							}
-						}
-					}
-				}
-
 				continue;
 			}
 
 			glm::vec2 position = availablePositions[0];
 			LOG_DEBUG("Enemy {} positioned at ({:.1f}, {:.1f})", enemyIndex + 1, position.x, position.y);
 
-			// 記錄此怪物佔用的網格位置
-			RecordOccupiedPositions(position, enemySize, occupiedPositions);
-
 			// 設置怪物位置並添加到場景
 			auto enemy = SpawnEnemy(enemyType, position);
 			if (enemy)
@@ -574,99 +505,21 @@ std::vector<glm::vec2> MonsterRoom::GenerateSpawnPositions(int count)
 
 std::vector<glm::vec2> MonsterRoom::GenerateSpawnPositionsWithSize(int count, const glm::vec2 &entitySize)
 {
-	std::vector<glm::vec2> positions;
-	const glm::vec2 &tileSize = m_RoomSpaceInfo.m_TileSize;
-	const glm::vec2 &roomSize = m_RoomSpaceInfo.m_RoomSize;
-	const glm::vec2 &region = m_RoomSpaceInfo.m_RoomRegion;
-	const glm::vec2 &roomCoord = m_RoomSpaceInfo.m_WorldCoord;
-
-	const int regionWidth = static_cast<int>(region.x);
-	const int regionHeight = static_cast<int>(region.y);
-	const int roomWidth = static_cast<int>(roomSize.x);
-	const int roomHeight = static_cast<int>(roomSize.y);
-
-	// 計算實體需要佔用的網格大小
-	const int entityGridWidth = static_cast<int>(std::ceil(entitySize.x / tileSize.x));
-	const int entityGridHeight = static_cast<int>(std::ceil(entitySize.y / tileSize.y));
-
-	// 修正：計算房間內部可生成的區域（避免邊界，並考慮實體大小）
-	const int centerX = regionWidth / 2;
-	const int centerY = regionHeight / 2;
-	const int startX = centerX - roomWidth / 2 + 1; // 避開邊界牆壁
-	const int startY = centerY - roomHeight / 2 + 1;
-	const int endX = centerX + roomWidth / 2 - 1 - (entityGridWidth - 1); // 減去實體寬度
-	const int endY = centerY + roomHeight / 2 - 1 - (entityGridHeight - 1); // 減去實體高度
-
-	// 確保範圍有效
-	if (startX >= endX || startY >= endY)
-	{
-		LOG_ERROR("Invalid spawn area for entity size {}x{}: startX={}, endX={}, startY={}, endY={}", entitySize.x,
-				  entitySize.y, startX, endX, startY, endY);
-		return positions;
-	}
-
-	// 創建可用位置列表（使用體型感知的檢查）
-	std::vector<glm::ivec2> availablePositions;
-	for (int row = startY; row < endY; ++row)
-	{
-		for (int col = startX; col < endX; ++col)
-		{
-			// 檢查實體佔用的所有網格是否都可用
-			if (IsAreaClearForEntity({col, row}, entityGridWidth, entityGridHeight))
-			{
-				availablePositions.push_back({col, row});
-			}
-		}
-	}
-
-	// 檢查是否有足夠的可用位置
-	if (availablePositions.size() < static_cast<size_t>(count))
-	{
-		LOG_WARN("Not enough available positions for entity size {}x{}! Requested: {}, Available: {}", entitySize.x,
-				 entitySize.y, count, availablePositions.size());
-		// 返回所有可用位置，而不是失敗
-		count = static_cast<int>(availablePositions.size());
-	}
-
-	// 隨機選擇位置
+	SpawnAreaTable spawnTable;
+	spawnTable.Build(GetGridData());
 	std::mt19937 rng(std::random_device{}());
-	std::shuffle(availablePositions.begin(), availablePositions.end(), rng);
 
-	// 轉換為世界座標（格子左上角 → 實體中心）
-	for (int i = 0; i < count && i < static_cast<int>(availablePositions.size()); ++i)
+	std::vector<glm::vec2> positions = ClaimSpawnPositions(count, entitySize, spawnTable, rng);
+	if (positions.size() < static_cast<size_t>(count))
 	{
-		const glm::ivec2 &gridPos = availablePositions[i];
-
-		// 計算實體中心的正確位置
-		glm::vec2 entityCenter = CalculateEntityCenterPosition(gridPos, entitySize, entityGridWidth, entityGridHeight,
-															   tileSize, roomCoord, region);
-
-		positions.push_back(entityCenter);
+		LOG_WARN("Not enough available positions for entity size {}x{}! Requested: {}, Available: {}", entitySize.x,
+				 entitySize.y, count, positions.size());
 	}
-
 	return positions;
 }
 
-bool MonsterRoom::IsAreaClearForEntity(const glm::ivec2 &gridPos, int entityGridWidth, int entityGridHeight) const
-{
-	// 檢查實體佔用的所有網格是否都可用
-	for (int row = gridPos.y; row < gridPos.y + entityGridHeight; ++row)
-	{
-		for (int col = gridPos.x; col < gridPos.x + entityGridWidth; ++col)
-		{
-			// 檢查網格是否超出邊界或被阻擋
-			if (IsGridPositionBlocked(row, col))
-			{
-				return false;
-			}
-		}
-	}
-	return true;
-}
-
-std::vector<glm::vec2>
-MonsterRoom::GenerateSpawnPositionsWithSizeAndExclusions(int count, const glm::vec2 &entitySize,
-														 const std::vector<glm::ivec2> &occupiedPositions)
+std::vector<glm::vec2> MonsterRoom::ClaimSpawnPositions(int count, const glm::vec2 &entitySize,
+														SpawnAreaTable &spawnTable, std::mt19937 &rng) const
 {
 	std::vector<glm::vec2> positions;
 	const glm::vec2 &tileSize = m_RoomSpaceInfo.m_TileSize;
@@ -683,13 +536,13 @@ MonsterRoom::GenerateSpawnPositionsWithSizeAndExclusions(int count, const glm::v
 	const int entityGridWidth = static_cast<int>(std::ceil(entitySize.x / tileSize.x));
 	const int entityGridHeight = static_cast<int>(std::ceil(entitySize.y / tileSize.y));
 
-	// 計算可生成區域
+	// 計算房間內部可生成的區域（避免邊界，並考慮實體大小）
 	const int centerX = regionWidth / 2;
 	const int centerY = regionHeight / 2;
-	const int startX = centerX - roomWidth / 2 + 1;
+	const int startX = centerX - roomWidth / 2 + 1; // 避開邊界牆壁
 	const int startY = centerY - roomHeight / 2 + 1;
-	const int endX = centerX + roomWidth / 2 - 1 - (entityGridWidth - 1);
-	const int endY = centerY + roomHeight / 2 - 1 - (entityGridHeight - 1);
+	const int endX = centerX + roomWidth / 2 - 1 - (entityGridWidth - 1); // 減去實體寬度
+	const int endY = centerY + roomHeight / 2 - 1 - (entityGridHeight - 1); // 減去實體高度
 
 	if (startX >= endX || startY >= endY)
 	{
@@ -697,87 +550,22 @@ MonsterRoom::GenerateSpawnPositionsWithSizeAndExclusions(int count, const glm::v
 		return positions;
 	}
 
-	// 創建可用位置列表
-	std::vector<glm::ivec2> availablePositions;
-	for (int row = startY; row < endY; ++row)
+	// 每次隨機挑一個放得下的位置並佔用，同一批的實體也不會互相重疊
+	for (int i = 0; i < count; ++i)
 	{
-		for (int col = startX; col < endX; ++col)
-		{
-			// 檢查是否與已佔用位置重疊
-			if (IsAreaOverlapWithOccupied({col, row}, entityGridWidth, entityGridHeight, occupiedPositions))
-			{
-				continue;
-			}
-
-			// 檢查實體佔用的所有網格是否都可用
-			if (IsAreaClearForEntity({col, row}, entityGridWidth, entityGridHeight))
-			{
-				availablePositions.push_back({col, row});
-			}
-		}
-	}
-
-	// 隨機選擇位置
-	std::mt19937 rng(std::random_device{}());
-	std::shuffle(availablePositions.begin(), availablePositions.end(), rng);
-
-	// 轉換為世界座標
-	int actualCount = std::min(count, static_cast<int>(availablePositions.size()));
-	for (int i = 0; i < actualCount; ++i)
-	{
-		const glm::ivec2 &gridPos = availablePositions[i];
-
-		// 計算實體中心的正確位置
-		glm::vec2 entityCenter = CalculateEntityCenterPosition(gridPos, entitySize, entityGridWidth, entityGridHeight,
-															   tileSize, roomCoord, region);
-
-		positions.push_back(entityCenter);
+		glm::ivec2 gridPos;
+		if (!spawnTable.PickRandom({startX, startY}, {endX, endY}, entityGridWidth, entityGridHeight, rng, gridPos))
+			break;
+		spawnTable.Claim(gridPos.x, gridPos.y, entityGridWidth, entityGridHeight);
+
+		// 計算實體中心的正確位置（格子左上角 → 實體中心）
+		positions.push_back(CalculateEntityCenterPosition(gridPos, entitySize, entityGridWidth, entityGridHeight,
+														  tileSize, roomCoord, region));
 	}
 
 	return positions;
 }
 
-bool MonsterRoom::IsAreaOverlapWithOccupied(const glm::ivec2 &gridPos, int entityGridWidth, int entityGridHeight,
-											const std::vector<glm::ivec2> &occupiedPositions) const
-{
-	// 檢查新實體的佔用區域是否與已佔用位置重疊
-	for (const auto &occupied : occupiedPositions)
-	{
-		// 簡單矩形重疊檢測
-		if (gridPos.x < occupied.x + 1 && gridPos.x + entityGridWidth > occupied.x && gridPos.y < occupied.y + 1 &&
-			gridPos.y + entityGridHeight > occupied.y)
-		{
-			return true; // 有重疊
-		}
-	}
-	return false; // 無重疊
-}
-
-void MonsterRoom::RecordOccupiedPositions(const glm::vec2 &worldPos, const glm::vec2 &entitySize,
-										  std::vector<glm::ivec2> &occupiedPositions)
-{
-	const glm::vec2 &tileSize = m_RoomSpaceInfo.m_TileSize;
-	const glm::vec2 &roomCoord = m_RoomSpaceInfo.m_WorldCoord;
-	const glm::vec2 &region = m_RoomSpaceInfo.m_RoomRegion;
-
-	// 計算實體佔用的網格大小
-	const int entityGridWidth = static_cast<int>(std::ceil(entitySize.x / tileSize.x));
-	const int entityGridHeight = static_cast<int>(std::ceil(entitySize.y / tileSize.y));
-
-	// 計算實體左上角對應的網格位置
-	glm::vec2 entityTopLeft = worldPos - glm::vec2(entitySize.x / 2.0f, -entitySize.y / 2.0f);
-	glm::ivec2 startGrid = Tool::WorldToRoomGrid(entityTopLeft, tileSize, roomCoord, region);
-
-	// 記錄所有佔用的網格位置
-	for (int row = startGrid.y; row < startGrid.y + entityGridHeight; ++row)
-	{
-		for (int col = startGrid.x; col < startGrid.x + entityGridWidth; ++col)
-		{
-			occupiedPositions.push_back({col, row});
-		}
-	}
-}
-
 glm::vec2 MonsterRoom::CalculateEntityCenterPosition(const glm::ivec2 &gridPos, const glm::vec2 &entitySize,
 													 int entityGridWidth, int entityGridHeight,
 													 const glm::vec2 &tileSize, const glm::vec2 &roomCoord,
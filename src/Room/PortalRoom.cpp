@@ -23,8 +23,7 @@ void PortalRoom::Update() { DungeonRoom::Update(); }
 
 void PortalRoom::LoadFromJSON()
 {
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadPortalRoomObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadPortalRoomObjectPosition());
 }
 
 void PortalRoom::CreatePortal()
@@ -15,7 +15,9 @@
 #include "RandomUtil.hpp"
 #include "Room/RoomCollisionManager.hpp"
 #include "Room/RoomInteractionManager.hpp"
+#include "Room/RoomPrefabCache.hpp"
 #include "Scene/SceneManager.hpp"
+#include "Util/ContentPack.hpp"
 #include "Util/Input.hpp"
 #include "fstream"
 
@@ -24,6 +26,7 @@ Room::~Room()
 	// 析构函数 - 确保正确清理资源
 	m_Characters.clear();
 	m_RoomObjects.clear();
+	m_LayoutObjects.clear();
 }
 
 void Room::Start(const std::shared_ptr<Character> &player)
@@ -35,8 +38,10 @@ void Room::Start(const std::shared_ptr<Character> &player)
 	AddManager(ManagerTypes::ROOMCOLLISION, m_CollisionManager);
 	AddManager(ManagerTypes::ROOMINTERACTIONMANAGER, m_InteractionManager);
 	AddManager(ManagerTypes::TRACKING, m_TrackingManager);
+	AddManager(ManagerTypes::AISCHEDULER, m_AIScheduler);
 
 	m_InteractionManager->SetPlayer(player);
+	m_AIScheduler->SetPlayer(player);
 
 	// 加载房间数据 TODO:要改 可能是读取head.json然后选择房间
 	LoadFromJSON();
@@ -207,11 +212,16 @@ void Room::RemoveRoomObject(const std::shared_ptr<nGameObject> &object)
 
 		// 从列表移除
 		m_RoomObjects.erase(std::remove(m_RoomObjects.begin(), m_RoomObjects.end(), object), m_RoomObjects.end());
+		m_LayoutObjects.erase(std::remove(m_LayoutObjects.begin(), m_LayoutObjects.end(), object),
+							  m_LayoutObjects.end());
 	}
 }
 
 nlohmann::json Room::ReadJsonFile(const std::string &filePath) const
 {
+	if (nlohmann::json packed; Util::ContentPack::GetInstance().TryLoadJson(filePath, packed))
+		return packed;
+
 	std::ifstream file(filePath);
 	if (!file.is_open())
 	{
@@ -224,26 +234,28 @@ nlohmann::json Room::ReadJsonFile(const std::string &filePath) const
 	return jsonData;
 }
 
-void Room::InitializeRoomObjects(const nlohmann::json &jsonData)
+void Room::InitializeRoomObjects(const std::shared_ptr<const RoomPrefab> &prefab)
 {
-	m_RoomSpaceInfo.m_TileSize =
-		glm::vec2(jsonData.at("tile_width").get<float>(), jsonData.at("tile_height").get<float>());
-	m_RoomSpaceInfo.m_RoomRegion =
-		glm::vec2(jsonData.at("room_region_x").get<float>(), jsonData.at("room_region_y").get<float>());
-	m_RoomSpaceInfo.m_RoomSize =
-		glm::vec2(jsonData.at("room_size_x").get<float>(), jsonData.at("room_size_y").get<float>());
+	m_LayoutPrefab = prefab;
+	if (!prefab)
+	{
+		LOG_ERROR("Room::InitializeRoomObjects: missing layout");
+		return;
+	}
+	m_RoomSpaceInfo.m_TileSize = prefab->tileSize;
+	m_RoomSpaceInfo.m_RoomRegion = prefab->roomRegion;
+	m_RoomSpaceInfo.m_RoomSize = prefab->roomSize;
 
-	for (const auto &elem : jsonData["roomObject"])
+	const auto factory = m_Factory.lock();
+	m_LayoutObjects.reserve(m_LayoutObjects.size() + prefab->tiles.size());
+	for (const auto &tile : prefab->tiles)
 	{
-		auto roomObject =
-			m_Factory.lock()->CreateRoomObject(elem.at("ID").get<std::string>(), elem.at("Class").get<std::string>());
+		auto roomObject = factory->CreateRoomObject(tile.id, tile.className);
 		if (roomObject)
 		{
-			const auto x = elem.at("Position")[0].get<float>();
-			const auto y = elem.at("Position")[1].get<float>();
-			const auto position = m_RoomSpaceInfo.m_WorldCoord + glm::vec2(x, y);
-			roomObject->SetWorldCoord(position);
+			roomObject->SetWorldCoord(m_RoomSpaceInfo.m_WorldCoord + tile.offset);
 			AddRoomObject(roomObject);
+			m_LayoutObjects.push_back(roomObject);
 		}
 	}
 }
@@ -321,6 +333,7 @@ void Room::RegisterTrackingManager(const std::shared_ptr<nGameObject> &object) c
 			break;
 		case CollisionLayers_Enemy:
 			m_TrackingManager->AddEnemy(std::dynamic_pointer_cast<Character>(object));
+			m_AIScheduler->Register(std::dynamic_pointer_cast<Character>(object));
 			break;
 		case CollisionLayers_Player:
 			m_TrackingManager->SetPlayer(std::dynamic_pointer_cast<Character>(object));
@@ -434,6 +447,7 @@ void Room::UnregisterTrackingManager(const std::shared_ptr<nGameObject> &object)
 			if (auto character = std::dynamic_pointer_cast<Character>(object))
 			{
 				m_TrackingManager->RemoveEnemy(character);
+				m_AIScheduler->Unregister(character);
 			}
 			break;
 		case CollisionLayers_Player:
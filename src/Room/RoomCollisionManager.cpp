@@ -23,9 +23,9 @@ void RoomCollisionManager::RegisterNGameObject(const std::shared_ptr<nGameObject
 	if (const auto collisionComp = nGameObject->GetComponent<CollisionComponent>(ComponentType::COLLISION);
 		collisionComp)
 	{
-		m_NGameObjects.push_back(nGameObject);
+		m_NGameObjects.Add(nGameObject);
 		if (collisionComp->IsTrigger())
-			m_TriggerObjects.push_back(nGameObject);
+			m_TriggerObjects.Add(nGameObject);
 	}
 	else
 	{
@@ -35,27 +35,9 @@ void RoomCollisionManager::RegisterNGameObject(const std::shared_ptr<nGameObject
 
 void RoomCollisionManager::UnregisterNGameObject(const std::shared_ptr<nGameObject> &nGameObject)
 {
-	// 移除一般 GameObject
-	m_NGameObjects.erase(std::remove_if(m_NGameObjects.begin(), m_NGameObjects.end(),
-										[&nGameObject](const auto &weakPtr)
-										{
-											if (weakPtr.expired())
-												return false; // 檢查weak_ptr是否過期
-											const auto sharedPtr = weakPtr.lock(); // 轉換成shared_ptr來比較
-											return sharedPtr.get() == nGameObject.get(); // 比較指針地址
-										}),
-						 m_NGameObjects.end());
-
-	// 移除 Trigger GameObject（子集）
-	m_TriggerObjects.erase(std::remove_if(m_TriggerObjects.begin(), m_TriggerObjects.end(),
-										  [&nGameObject](const auto &weakPtr)
-										  {
-											  if (weakPtr.expired())
-												  return false;
-											  const auto sharedPtr = weakPtr.lock();
-											  return sharedPtr.get() == nGameObject.get();
-										  }),
-						   m_TriggerObjects.end());
+	// 索引表查位置後swap-and-pop，不再線性掃描
+	m_NGameObjects.Remove(nGameObject.get());
+	m_TriggerObjects.Remove(nGameObject.get()); // 扳機子集
 }
 
 void RoomCollisionManager::Update()
@@ -68,22 +50,23 @@ void RoomCollisionManager::Update()
 
 	m_SpatialGrid.Clear();
 
-	for (const auto &weakObj : m_NGameObjects)
-	{
-		auto obj = weakObj.lock();
-		if (!obj || !obj->IsActive())
-			continue;
+	// 順便清掉已銷毀的物件
+	m_NGameObjects.ForEachAlive(
+		[&](const std::shared_ptr<nGameObject> &obj)
+		{
+			if (!obj->IsActive())
+				return;
 
-		const std::shared_ptr<CollisionComponent> collider =
-			obj->GetComponent<CollisionComponent>(ComponentType::COLLISION);
-		if (!collider || !collider->IsActive())
-			continue;
+			const std::shared_ptr<CollisionComponent> collider =
+				obj->GetComponent<CollisionComponent>(ComponentType::COLLISION);
+			if (!collider || !collider->IsActive())
+				return;
 
-		m_SpatialGrid.Insert(obj, collider->GetBounds());
-	}
+			m_SpatialGrid.Insert(obj, collider->GetBounds());
+		});
 
 
-	std::for_each(m_NGameObjects.begin(), m_NGameObjects.end(),
+	std::for_each(m_NGameObjects.Items().begin(), m_NGameObjects.Items().end(),
 				  [&](const auto &weakObj)
 				  {
 					  const std::shared_ptr<nGameObject> objectA = weakObj.lock();
@@ -134,17 +117,15 @@ void RoomCollisionManager::Update()
 		DispatchCollision(objectA, objectB, info);
 	}
 
-	for (const auto &weakObj : m_TriggerObjects)
-	{
-		if (const auto obj = weakObj.lock())
+	m_TriggerObjects.ForEachAlive(
+		[](const std::shared_ptr<nGameObject> &obj)
 		{
 			if (const auto collider = obj->GetComponent<CollisionComponent>(ComponentType::COLLISION);
 				collider && collider->IsActive())
 			{
 				collider->FinishTriggerFrame(obj);
 			}
-		}
-	}
+		});
 }
 
 void RoomCollisionManager::CalculateCollisionDetails(const std::shared_ptr<nGameObject> &objectA,
@@ -0,0 +1,96 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Room/RoomPrefabCache.hpp"
+
+#include "Loader.hpp"
+#include "Util/Logger.hpp"
+
+RoomPrefabCache &RoomPrefabCache::GetInstance()
+{
+	static RoomPrefabCache instance;
+	return instance;
+}
+
+std::shared_ptr<const RoomPrefab> RoomPrefabCache::GetPrefab(const std::string &layoutPath, Loader &loader)
+{
+	std::lock_guard lock(m_Mutex);
+	if (const auto it = m_Prefabs.find(layoutPath); it != m_Prefabs.end())
+		return it->second;
+
+	std::shared_ptr<const RoomPrefab> prefab;
+	try
+	{
+		prefab = std::make_shared<RoomPrefab>(ParsePrefab(layoutPath, loader.readJsonFile(layoutPath)));
+	}
+	catch (const std::exception &e)
+	{
+		LOG_ERROR("RoomPrefabCache: cannot load layout {}: {}", layoutPath, e.what());
+		return nullptr;
+	}
+	m_Prefabs.emplace(layoutPath, prefab);
+	return prefab;
+}
+
+std::shared_ptr<const RoomTerrainPrefab> RoomPrefabCache::FindTerrain(const RoomPrefab &prefab,
+																	  const uint8_t corridorMask) const
+{
+	std::lock_guard lock(m_Mutex);
+	const auto it = m_Terrains.find(TerrainKey(prefab, corridorMask));
+	return it == m_Terrains.end() ? nullptr : it->second;
+}
+
+std::shared_ptr<const RoomTerrainPrefab> RoomPrefabCache::StoreTerrain(const RoomPrefab &prefab,
+																	   const uint8_t corridorMask,
+																	   RoomTerrainPrefab terrain)
+{
+	std::lock_guard lock(m_Mutex);
+	// 兩邊同時算出來時留先到的那份，內容一樣
+	const auto [it, inserted] = m_Terrains.emplace(TerrainKey(prefab, corridorMask),
+												   std::make_shared<const RoomTerrainPrefab>(std::move(terrain)));
+	return it->second;
+}
+
+void RoomPrefabCache::Clear()
+{
+	std::lock_guard lock(m_Mutex);
+	m_Prefabs.clear();
+	m_Terrains.clear();
+}
+
+void RoomPrefabCache::Invalidate(const std::string &layoutPath)
+{
+	std::lock_guard lock(m_Mutex);
+	m_Prefabs.erase(layoutPath);
+	const std::string prefix = layoutPath + '#';
+	for (auto it = m_Terrains.begin(); it != m_Terrains.end();)
+		it = it->first.compare(0, prefix.size(), prefix) == 0 ? m_Terrains.erase(it) : std::next(it);
+}
+
+RoomPrefab RoomPrefabCache::ParsePrefab(const std::string &layoutPath, const nlohmann::json &jsonData)
+{
+	RoomPrefab prefab;
+	prefab.layoutPath = layoutPath;
+	prefab.tileSize = glm::vec2(jsonData.at("tile_width").get<float>(), jsonData.at("tile_height").get<float>());
+	prefab.roomRegion =
+		glm::vec2(jsonData.at("room_region_x").get<float>(), jsonData.at("room_region_y").get<float>());
+	prefab.roomSize = glm::vec2(jsonData.at("room_size_x").get<float>(), jsonData.at("room_size_y").get<float>());
+
+	const auto &objects = jsonData.at("roomObject");
+	prefab.tiles.reserve(objects.size());
+	for (const auto &elem : objects)
+	{
+		RoomPrefabTile tile;
+		tile.id = elem.at("ID").get<std::string>();
+		tile.className = elem.at("Class").get<std::string>();
+		tile.offset = glm::vec2(elem.at("Position")[0].get<float>(), elem.at("Position")[1].get<float>());
+		prefab.tiles.push_back(std::move(tile));
+	}
+	return prefab;
+}
+
+std::string RoomPrefabCache::TerrainKey(const RoomPrefab &prefab, const uint8_t corridorMask)
+{
+	return prefab.layoutPath + '#' + std::to_string(corridorMask);
+}
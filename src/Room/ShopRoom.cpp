@@ -39,8 +39,7 @@ void ShopRoom::Update()
 void ShopRoom::LoadFromJSON()
 {
 	// 使用專門的商店佈局檔案
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadShopRoomObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadShopRoomObjectPosition());
 }
 
 void ShopRoom::TryActivateByPlayer()
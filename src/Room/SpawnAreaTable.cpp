@@ -0,0 +1,82 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Room/SpawnAreaTable.hpp"
+
+#include <algorithm>
+
+void SpawnAreaTable::Build(const std::vector<std::vector<int>> &grid)
+{
+	m_Height = static_cast<int>(grid.size());
+	m_Width = m_Height > 0 ? static_cast<int>(grid[0].size()) : 0;
+	m_Table.assign(static_cast<size_t>(m_Width + 1) * (m_Height + 1), 0);
+
+	const int stride = m_Width + 1;
+	for (int row = 0; row < m_Height; ++row)
+	{
+		int rowSum = 0;
+		for (int col = 0; col < m_Width; ++col)
+		{
+			rowSum += grid[row][col] != 0 ? 1 : 0;
+			m_Table[(row + 1) * stride + col + 1] = m_Table[row * stride + col + 1] + rowSum;
+		}
+	}
+}
+
+bool SpawnAreaTable::IsFree(const int col, const int row, const int width, const int height) const
+{
+	if (col < 0 || row < 0 || width <= 0 || height <= 0 || col + width > m_Width || row + height > m_Height)
+		return false;
+	const int x1 = col + width;
+	const int y1 = row + height;
+	return At(x1, y1) - At(col, y1) - At(x1, row) + At(col, row) == 0;
+}
+
+void SpawnAreaTable::Claim(const int col, const int row, const int width, const int height)
+{
+	const int x0 = std::max(col, 0);
+	const int y0 = std::max(row, 0);
+	const int x1 = std::min(col + width, m_Width);
+	const int y1 = std::min(row + height, m_Height);
+	if (x0 >= x1 || y0 >= y1)
+		return;
+
+	// 區域指示函數的前綴和直接疊加：(x, y) 增加 [x0, min(x, x1)) x [y0, min(y, y1)) 的面積
+	const int stride = m_Width + 1;
+	for (int y = y0 + 1; y <= m_Height; ++y)
+	{
+		const int dy = std::min(y, y1) - y0;
+		int *line = &m_Table[y * stride];
+		for (int x = x0 + 1; x <= m_Width; ++x)
+			line[x] += (std::min(x, x1) - x0) * dy;
+	}
+}
+
+bool SpawnAreaTable::PickRandom(const glm::ivec2 &start, const glm::ivec2 &end, const int width, const int height,
+								std::mt19937 &rng, glm::ivec2 &outTopLeft) const
+{
+	// 兩趟：先數有幾個可用位置，抽一個序號再找出來，不用配置候選清單
+	int available = 0;
+	for (int row = start.y; row < end.y; ++row)
+		for (int col = start.x; col < end.x; ++col)
+			available += IsFree(col, row, width, height) ? 1 : 0;
+	if (available == 0)
+		return false;
+
+	int pick = std::uniform_int_distribution<int>(0, available - 1)(rng);
+	for (int row = start.y; row < end.y; ++row)
+	{
+		for (int col = start.x; col < end.x; ++col)
+		{
+			if (!IsFree(col, row, width, height))
+				continue;
+			if (pick-- == 0)
+			{
+				outTopLeft = {col, row};
+				return true;
+			}
+		}
+	}
+	return false;
+}
@@ -22,8 +22,7 @@ void SpecialRoom::Update() { DungeonRoom::Update(); }
 
 void SpecialRoom::LoadFromJSON()
 {
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadPortalRoomObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadPortalRoomObjectPosition());
 }
 
 void SpecialRoom::SpawnSpecialObjects()
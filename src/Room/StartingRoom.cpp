@@ -14,6 +14,5 @@ void StartingRoom::Update() { DungeonRoom::Update(); }
 
 void StartingRoom::LoadFromJSON()
 {
-	const nlohmann::ordered_json jsonData = m_Loader.lock()->LoadStartingRoomObjectPosition();
-	InitializeRoomObjects(jsonData);
+	InitializeRoomObjects(m_Loader.lock()->LoadStartingRoomObjectPosition());
 }
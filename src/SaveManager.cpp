@@ -3,70 +3,93 @@
 //
 
 #include "SaveManager.hpp"
+#include <cstdio>
 #include <fstream>
 #include <sstream>
 #include <filesystem>
 
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 SaveManager::SaveManager(const std::string &saveDir)
 	: saveDirectory(saveDir), saveSlot(std::make_shared<SaveData>())
 {
 	// 確保存檔目錄存在
 	CreateSaveDirectory();
+	writerThread = std::thread([this] { WriterLoop(); });
 	LoadSaveData();
 }
 
+SaveManager::~SaveManager() {
+	// 寫完最後一份快照才結束
+	{
+		std::lock_guard lock(writerMutex);
+		stopWriter = true;
+	}
+	writerWakeUp.notify_one();
+	if (writerThread.joinable()) writerThread.join();
+}
+
 bool SaveManager::HasSaveData() const {
+	// 已經排入背景寫檔的存檔也算（檔案可能還沒落地）
+	{
+		std::lock_guard lock(writerMutex);
+		if (pendingSnapshot || isWriting) return true;
+	}
 	try {
-		const std::string filename = saveDirectory + "save_game.json";
-		std::ifstream file(filename);
-		if (!file.is_open()) return false;
-
-		// 檢查檔案內容是否為空
-		std::stringstream buffer;
-		buffer << file.rdbuf();
-		std::string content = buffer.str();
-
-		if (content.empty()) return false;
-
-		nlohmann::json j = nlohmann::json::parse(content);
+		nlohmann::json j;
+		if (!ReadSaveFile(GetSaveFilePath(saveFormat), saveFormat, j)) {
+			const SaveFormat other = saveFormat == SaveFormat::JSON ? SaveFormat::MSGPACK : SaveFormat::JSON;
+			if (!ReadSaveFile(GetSaveFilePath(other), other, j)) return false;
+		}
 		if (j.is_null() || j.empty()) return false;
 
 		return true;
 	}
 	catch (const std::exception& e) {
-		LOG_INFO("Error checking save_game.json file: {}", e.what());
+		LOG_INFO("Error checking save file: {}", e.what());
 		return false;
 	}
 }
 
 bool SaveManager::SaveGame(const std::shared_ptr<SaveData>& saveData) {
-	try {
-		saveSlot = saveData;
-		saveData->saveTime = GetCurrentTimeString(); // 自動設置保存時間
-
-		const std::string filename = saveDirectory + "save_game.json";
-		std::ofstream file(filename);
-		if (!file.is_open()) return false;
-
-		nlohmann::json j = saveSlot->toJson();
-		// pretty format(自動縮排（indentation）空格數)
-		file << j.dump(4);
-		file.close();
-
-		LOG_INFO("Game saved successfully");
-		return true;
-	}
-	catch (const std::exception& e) {
-		LOG_ERROR("Exception occurred while writing to file: {}", e.what());
-		return false;
+	if (!saveData) return false;
+
+	saveSlot = saveData;
+	saveData->saveTime = GetCurrentTimeString(); // 自動設置保存時間
+	{
+		// 在主執行緒複製快照，之後遊戲再改saveData也不影響這次寫入；舊的待寫快照直接被蓋掉
+		std::lock_guard lock(writerMutex);
+		pendingSnapshot.emplace(*saveData, saveFormat);
 	}
+	writerWakeUp.notify_one();
+	return true;
+}
+
+void SaveManager::Flush() {
+	std::unique_lock lock(writerMutex);
+	writerIdle.wait(lock, [this] { return !pendingSnapshot && !isWriting; });
 }
 
 bool SaveManager::DeleteSave() {
 	try {
-		std::string filename = saveDirectory + "save_game.json";
+		{
+			// 丟掉還沒寫的快照，並等寫到一半的那份寫完，免得刪完又被寫回來
+			std::unique_lock lock(writerMutex);
+			pendingSnapshot.reset();
+			writerIdle.wait(lock, [this] { return !isWriting; });
+			lastWritten.clear();
+		}
+		writerIdle.notify_all();
 
-		if (std::remove(filename.c_str()) == 0) {
+		bool deleted = false;
+		for (const SaveFormat format : {SaveFormat::JSON, SaveFormat::MSGPACK}) {
+			if (std::remove(GetSaveFilePath(format).c_str()) == 0) deleted = true;
+		}
+		if (deleted) {
 			LOG_INFO("Delete successfully");
 			// 清除内存中的数据(重置为空)
 			saveSlot = nullptr;
@@ -82,27 +105,117 @@ bool SaveManager::DeleteSave() {
 
 void SaveManager::LoadSaveData() {
 	try {
-		const std::string filename = saveDirectory + "save_game.json";
-		std::ifstream file(filename);
-		if (file.is_open()) {
-			nlohmann::json j;
-			file >> j;
-			file.close();
-
+		// 先讀目前格式的存檔，沒有再讀另一種格式（切換格式後舊存檔照樣能讀）
+		const SaveFormat other = saveFormat == SaveFormat::JSON ? SaveFormat::MSGPACK : SaveFormat::JSON;
+		nlohmann::json j;
+		if (ReadSaveFile(GetSaveFilePath(saveFormat), saveFormat, j) ||
+			ReadSaveFile(GetSaveFilePath(other), other, j)) {
 			saveSlot = std::make_shared<SaveData>();
 			saveSlot->fromJson(j);
 		} else {
-			LOG_INFO("No save_game.json file found, creating new save data");
+			LOG_INFO("No save file found, creating new save data");
 			saveSlot = std::make_shared<SaveData>(); // 給一個新的空白存檔
 			SaveGame(saveSlot);
 		}
 	}
 	catch (const std::exception& e) {
-		LOG_ERROR("Error loading save_game.json: {}", e.what());
+		LOG_ERROR("Error loading save file: {}", e.what());
 		saveSlot = std::make_shared<SaveData>(); // 保底保證不為 null
 	}
 }
 
+std::string SaveManager::GetSaveFilePath(const SaveFormat format) const {
+	return saveDirectory + (format == SaveFormat::MSGPACK ? "save_game.msgpack" : "save_game.json");
+}
+
+bool SaveManager::ReadSaveFile(const std::string &filename, const SaveFormat format, nlohmann::json &j) {
+	std::ifstream file(filename, std::ios::binary);
+	if (!file.is_open()) return false;
+
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	const std::string content = buffer.str();
+	if (content.empty()) return false;
+
+	j = format == SaveFormat::MSGPACK ? nlohmann::json::from_msgpack(content) : nlohmann::json::parse(content);
+	return true;
+}
+
+void SaveManager::WriterLoop() {
+	std::unique_lock lock(writerMutex);
+	while (true) {
+		writerWakeUp.wait(lock, [this] { return pendingSnapshot.has_value() || stopWriter; });
+		if (!pendingSnapshot) break; // 要結束且沒有待寫的快照
+
+		auto [snapshot, format] = std::move(*pendingSnapshot);
+		pendingSnapshot.reset();
+		isWriting = true;
+		lock.unlock();
+		WriteSnapshot(snapshot, format);
+		lock.lock();
+		isWriting = false;
+		if (!pendingSnapshot) writerIdle.notify_all();
+	}
+}
+
+void SaveManager::WriteSnapshot(const SaveData &snapshot, const SaveFormat format) {
+	try {
+		const nlohmann::json j = snapshot.toJson();
+		std::string content;
+		if (format == SaveFormat::MSGPACK) {
+			const std::vector<std::uint8_t> bytes = nlohmann::json::to_msgpack(j);
+			content.assign(bytes.begin(), bytes.end());
+		} else {
+			// pretty format(自動縮排（indentation）空格數)
+			content = j.dump(4);
+		}
+		if (content == lastWritten) return; // 跟磁碟上的一樣，不用再寫
+
+		if (WriteFileAtomically(GetSaveFilePath(format), content)) {
+			lastWritten = std::move(content);
+			// 另一種格式的舊存檔刪掉，否則切回那個格式時會讀到比較舊的進度
+			const SaveFormat other = format == SaveFormat::JSON ? SaveFormat::MSGPACK : SaveFormat::JSON;
+			std::error_code error;
+			std::filesystem::remove(GetSaveFilePath(other), error);
+			LOG_INFO("Game saved successfully");
+		} else {
+			LOG_ERROR("Failed to write {}", GetSaveFilePath(format));
+		}
+	}
+	catch (const std::exception& e) {
+		LOG_ERROR("Exception occurred while writing to file: {}", e.what());
+	}
+}
+
+bool SaveManager::WriteFileAtomically(const std::string &filename, const std::string &content) {
+	const std::string tempFilename = filename + ".tmp";
+	std::FILE *file = std::fopen(tempFilename.c_str(), "wb");
+	if (!file) return false;
+
+	// 暫存檔完整寫進磁碟後才改名，中途當掉或斷電只會留下沒用的.tmp，正式存檔不受影響
+	bool ok = std::fwrite(content.data(), 1, content.size(), file) == content.size() && std::fflush(file) == 0;
+#ifdef _WIN32
+	ok = ok && _commit(_fileno(file)) == 0;
+#else
+	ok = ok && fsync(fileno(file)) == 0;
+#endif
+	ok = std::fclose(file) == 0 && ok;
+	if (!ok) {
+		std::remove(tempFilename.c_str());
+		return false;
+	}
+
+	// 同一資料夾內改名會直接取代舊檔（Windows上是MoveFileEx + REPLACE_EXISTING）
+	std::error_code error;
+	std::filesystem::rename(tempFilename, filename, error);
+	if (error) {
+		LOG_ERROR("Failed to replace {}: {}", filename, error.message());
+		std::remove(tempFilename.c_str());
+		return false;
+	}
+	return true;
+}
+
 void SaveManager::CreateSaveDirectory() const {
 	// 判斷和建立資料夾
 	if (!std::filesystem::exists(saveDirectory)) {
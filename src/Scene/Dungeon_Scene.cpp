@@ -5,6 +5,7 @@
 
 #include "Scene/Dungeon_Scene.hpp"
 
+#include <filesystem>
 #include <functional>
 
 #include "Components/CollisionComponent.hpp"
@@ -12,16 +13,19 @@
 
 #include "Attack/AttackManager.hpp"
 #include "Components/InteractableComponent.hpp"
+#include "ContentHotReload.hpp"
 #include "Cursor.hpp"
 #include "Loader.hpp"
 #include "ObserveManager/InputManager.hpp"
 #include "SaveManager.hpp"
 #include "Scene/SceneManager.hpp"
+#include "Util/AssetArchive.hpp"
 
 
 #include "Util/Input.hpp"
 #include "Util/Keycode.hpp"
 #include "Util/Logger.hpp"
+#include "Util/WorkStealingPool.hpp"
 
 #include "Components/InputComponent.hpp"
 #include "Components/walletComponent.hpp"
@@ -34,6 +38,7 @@
 #include "Room/DungeonMap.hpp"
 #include "Room/MonsterRoom.hpp"
 #include "Room/MonsterRoomTestUI.hpp"
+#include "Room/RoomPrefabCache.hpp"
 #include "Structs/EventInfo.hpp"
 #include "UIPanel/GameHUDPanel.hpp"
 #include "UIPanel/KeyPanel.hpp"
@@ -49,7 +54,7 @@
 // 簡單的回調函數用於暫停按鈕
 void OpenPausePanelDungeon() { UIManager::GetInstance().ShowPanel("pause"); }
 
-std::shared_ptr<DungeonScene> DungeonScene::s_PreGeneratedInstance = nullptr;
+std::future<std::shared_ptr<const DungeonPlan>> DungeonScene::s_PreGeneratedPlan;
 
 void DungeonScene::Start()
 {
@@ -69,6 +74,8 @@ void DungeonScene::Start()
 	}
 
 	m_Loader = std::make_shared<Loader>(m_ThemeName);
+	// 主題圖片在封存檔裏是連續的，先請作業系統循序預讀
+	Util::AssetArchive::GetInstance().Prefetch(m_ThemeName);
 
 	// if(!m_OnDeathText)
 	// {
@@ -95,7 +102,7 @@ void DungeonScene::Start()
 	m_RoomObjectFactory = std::make_shared<RoomObjectFactory>(m_Loader);
 
 	m_Map = std::make_shared<DungeonMap>(m_RoomObjectFactory, m_Loader, m_Player);
-	m_Map->Start();
+	m_Map->Start(GetPreGenerated(m_ThemeName, m_SceneData->gameProgress.currentStage));
 
 	InitUIManager();
 	InitAudioManager();
@@ -106,6 +113,9 @@ void DungeonScene::Start()
 	// 初始化測試UI
 	InitializeMonsterRoomTestUI();
 
+	m_HotReloadListenerID = ContentHotReload::GetInstance().Subscribe([this](const std::string &relativePath)
+																	  { OnContentReloaded(relativePath); });
+
 	FlushPendingObjectsToRendererAndCamera();
 
 	// 更新游戲數據
@@ -140,6 +150,10 @@ void DungeonScene::Update()
 			m_CurrentRoom = dungeonRoom;
 			dungeonRoom->Update();
 
+			// 玩家到了傳送門房間，趁還在這關時在背景規劃下一關
+			if (dungeonRoom->GetRoomType() == RoomType::PORTAL && m_SceneData)
+				GenerateStaticDungeon(m_ThemeName, m_SceneData->gameProgress.currentStage + 1);
+
 			// dungeonRoom->DebugDungeonRoom();
 		}
 
@@ -192,6 +206,7 @@ void DungeonScene::Update()
 void DungeonScene::Exit()
 {
 	LOG_DEBUG("Game Scene exited");
+	ContentHotReload::GetInstance().Unsubscribe(m_HotReloadListenerID);
 
 	// 保存游戲的進度（但不增加關卡數）
 	auto cumulativeTime = Util::Time::GetElapsedTimeMs() - m_SceneData->gameProgress.dungeonStartTime;
@@ -240,42 +255,37 @@ Scene::SceneType DungeonScene::Change()
 	return Scene::SceneType::Null;
 }
 
-void DungeonScene::GenerateStaticDungeon()
+void DungeonScene::GenerateStaticDungeon(const std::string &theme, const int stage)
 {
-	s_PreGeneratedInstance = std::make_shared<DungeonScene>();
-	s_PreGeneratedInstance->BuildDungeon(); // 真正重的初始化過程
+	if (s_PreGeneratedPlan.valid())
+		return;
+	s_PreGeneratedPlan = std::async(std::launch::async,
+									[theme, stage]
+									{
+										// 順便預讀下一關的主題圖片
+										Util::AssetArchive::GetInstance().Prefetch(theme);
+										return DungeonMap::GeneratePlan(theme, stage);
+									});
 }
 
-std::shared_ptr<DungeonScene> DungeonScene::GetPreGenerated()
+std::shared_ptr<const DungeonPlan> DungeonScene::GetPreGenerated(const std::string &theme, const int stage)
 {
-	if (!s_PreGeneratedInstance)
+	if (!s_PreGeneratedPlan.valid())
+		return nullptr;
+	// 通常在傳送門房間時就已經算完，這裏不會等
+	std::shared_ptr<const DungeonPlan> plan = s_PreGeneratedPlan.get();
+	if (!plan || plan->theme != theme || plan->stage != stage)
 	{
-		LOG_ERROR("s_PreGeneratedInstance is null! You forgot to call GenerateStaticDungeon?");
+		LOG_WARN("Pre-generated dungeon does not match stage {} of '{}', generating now", stage, theme);
+		return nullptr;
 	}
-	return s_PreGeneratedInstance;
+	return plan;
 }
 
-void DungeonScene::ClearPreGenerated() { s_PreGeneratedInstance = nullptr; }
-
-void DungeonScene::BuildDungeon()
+void DungeonScene::ClearPreGenerated()
 {
-	m_Loader = std::make_shared<Loader>(m_ThemeName);
-
-	// 创建并初始化玩家
-	CreatePlayer();
-
-	// 设置相机
-	m_MapHeight = 5 * 35 * 16; // Dungeon 5個房間 35個方塊 16像素
-	SetupCamera();
-
-	// 設置工廠
-	m_RoomObjectFactory = std::make_shared<RoomObjectFactory>(m_Loader);
-
-	m_Map = std::make_shared<DungeonMap>(m_RoomObjectFactory, m_Loader, m_Player);
-	m_Map->Start();
-
-	// 初始化场景管理器
-	InitializeSceneManagers();
+	if (s_PreGeneratedPlan.valid())
+		s_PreGeneratedPlan.get();
 }
 
 void DungeonScene::SetupCamera() const
@@ -327,7 +337,7 @@ void DungeonScene::InitUIManager()
 void DungeonScene::InitAudioManager()
 {
 	AudioManager::GetInstance().Reset();
-	AudioManager::GetInstance().LoadFromJson("/AudioConfig.json");
+	AudioManager::GetInstance().LoadFromJson("/AudioConfig.json", m_ThemeName); // 每個主題（章節）一組音效
 	AudioManager::GetInstance().PlayBGM("dungeon");
 }
 
@@ -611,6 +621,37 @@ void DungeonScene::DrawGameDebugUI()
 		}
 	}
 
+	// === 攻擊物件池調試 ===
+	if (ImGui::CollapsingHeader("Attack Pools"))
+	{
+		if (const auto attackManager = GetManager<AttackManager>(ManagerTypes::ATTACK))
+		{
+			const auto showStats = [](const char *name, const AttackPoolStats &stats)
+			{
+				ImGui::Text("%s: in use %zu / created %zu (prewarm %zu)", name, stats.inUse, stats.created,
+							stats.prewarmed);
+				ImGui::Text("  high-water %zu, grew %zu times", stats.highWaterMark, stats.growCount);
+			};
+			showStats("Projectile", attackManager->GetProjectilePoolStats());
+			showStats("EffectAttack", attackManager->GetEffectPoolStats());
+			ImGui::Text("SoA bullets: %zu / %zu", attackManager->GetBulletSystem().GetCount(), BulletSystem::MAX_BULLETS);
+		}
+	}
+
+	// === 敵人AI排程調試 ===
+	if (ImGui::CollapsingHeader("AI Scheduler"))
+	{
+		if (m_CurrentRoom)
+		{
+			const auto &stats = m_CurrentRoom->GetAIScheduler()->GetStats();
+			ImGui::Text("Registered: %zu (inactive %zu)", stats.registered, stats.inactive);
+			ImGui::Text("Thinks this frame: %zu, deferred %zu", stats.thinkCount, stats.dueSkipped);
+			ImGui::Text("Think time: %.1f / %.0f us", stats.elapsedMicros, AIScheduler::THINK_BUDGET_MICROS);
+			ImGui::Text("Perception workers: %zu", Util::WorkStealingPool::GetInstance().GetWorkerCount());
+			ImGui::Text("Crowd separation: %zu / %zu adjusted", stats.crowdAdjusted, stats.crowdAgents);
+		}
+	}
+
 	// === MonsterRoom 調試 ===
 	if (ImGui::CollapsingHeader("Monster Room", ImGuiTreeNodeFlags_DefaultOpen))
 	{
@@ -815,6 +856,34 @@ void DungeonScene::ChangeCurrentRoomLayout(const std::string &layoutName)
 	}
 }
 
+void DungeonScene::OnContentReloaded(const std::string &relativePath)
+{
+	// 物件定義表已經被丟掉，之後生成的房間會用新的
+	const bool isObjectData = relativePath.rfind(m_ThemeName + "/ObjectData/", 0) == 0;
+	if (isObjectData)
+		m_RoomObjectFactory->ReloadObjectData();
+
+	// 背景規劃好的下一關還拿著改動前的佈局，丟掉；人還在傳送門房間的話下一幀會重新規劃
+	if (relativePath.rfind(m_ThemeName + "/", 0) == 0)
+		ClearPreGenerated();
+
+	const auto monsterRoom = std::dynamic_pointer_cast<MonsterRoom>(m_Map->GetCurrentRoom());
+	if (!monsterRoom || !monsterRoom->GetLayoutPrefab())
+		return;
+
+	// 只重建受影響的房間：改的是它的佈局，或是它用到的物件定義
+	const std::string &layoutPath = monsterRoom->GetLayoutPrefab()->layoutPath;
+	if (!isObjectData && layoutPath != JSON_DIR "/" + relativePath)
+		return;
+
+	if (!monsterRoom->CanChangeLayout())
+	{
+		LOG_INFO("Hot reload: {} changed during combat, the current room keeps the old layout", relativePath);
+		return;
+	}
+	ChangeCurrentRoomLayout(std::filesystem::path(layoutPath).stem().string());
+}
+
 void DungeonScene::TriggerPlayerShowUp()
 {
 	if (!m_Player)
@@ -269,6 +269,6 @@ void LobbyScene::InitUIManager()
 void LobbyScene::InitAudioManager()
 {
 	AudioManager::GetInstance().Reset();
-	AudioManager::GetInstance().LoadFromJson("/AudioConfig.json");
+	AudioManager::GetInstance().LoadFromJson("/AudioConfig.json", "Lobby");
 	AudioManager::GetInstance().PlayBGM("lobby");
 }
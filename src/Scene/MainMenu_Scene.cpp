@@ -22,6 +22,7 @@
 #include "Util/Input.hpp"
 #include "Util/Keycode.hpp"
 #include "Util/Logger.hpp"
+#include "Util/StartupTrace.hpp"
 #include "Util/Text.hpp"
 #include "Util/Time.hpp"
 #include "config.hpp"
@@ -40,15 +41,27 @@ void MainMenuScene::Start()
 	// 主菜單不需要數據也能正常運行，所以不檢查失敗情況
 	LOG_DEBUG("Scene data status: {}", m_SceneData ? "Available" : "Not available");
 
-	// 初始化界面物件
-	InitBackground();
-	InitTitleAndDecor();
-	InitTextLabels();
-	InitUIManager();
-	InitSettingButton();
-	InitDeleteDataButton();
-	InitMenuHUDPanel();
-	InitAudioManager();
+	// 初始化界面物件（各段計時記在啟動trace裏）
+	{
+		Util::StartupTrace::Scope phase("Menu images");
+		InitBackground();
+		InitTitleAndDecor();
+	}
+	{
+		Util::StartupTrace::Scope phase("Menu fonts");
+		InitTextLabels();
+	}
+	{
+		Util::StartupTrace::Scope phase("Menu UI panels");
+		InitUIManager();
+		InitSettingButton();
+		InitDeleteDataButton();
+		InitMenuHUDPanel();
+	}
+	{
+		Util::StartupTrace::Scope phase("Audio config");
+		InitAudioManager();
+	}
 	InitSlideAnimation();
 
 	m_Root->AddChild(m_Background);
@@ -229,7 +242,7 @@ void MainMenuScene::InitDeleteDataButton()
 void MainMenuScene::InitAudioManager()
 {
 	AudioManager::GetInstance().Reset();
-	AudioManager::GetInstance().LoadFromJson("/AudioConfig.json");
+	AudioManager::GetInstance().LoadFromJson("/AudioConfig.json", "MainMenu");
 	AudioManager::GetInstance().PlayBGM("opening");
 }
 
@@ -4,6 +4,7 @@
 
 #include "Scene/SceneManager.hpp"
 
+#include "ContentHotReload.hpp"
 #include "ObserveManager/EventManager.hpp"
 #include "SaveManager.hpp"
 #include "Scene/Complete_Scene.hpp"
@@ -14,6 +15,8 @@
 #include "Scene/Result_Scene.hpp"
 #include "Scene/Test_Scene_JX.hpp"
 #include "Scene/Test_Scene_KC.hpp"
+#include "Util/AssetPreloader.hpp"
+#include "Util/StartupTrace.hpp"
 
 SceneManager &SceneManager::GetInstance()
 {
@@ -24,6 +27,7 @@ SceneManager &SceneManager::GetInstance()
 void SceneManager::Start()
 {
 	// 初始化共享的場景數據
+	Util::StartupTrace::Scope saveDataPhase("Load save data");
 	auto &saveManager = SaveManager::GetInstance();
 	if (saveManager.HasSaveData())
 	{
@@ -38,7 +42,14 @@ void SceneManager::Start()
 		LOG_INFO("No saveData==>Init");
 		InitializeNewGameData();
 	}
+	saveDataPhase.End();
 
+	// 背景預載的圖片在建場景前放進快取
+	Util::AssetPreloader::GetInstance().Install();
+	// 開發用：CONTENT_HOT_RELOAD建置才會監看 json/
+	ContentHotReload::GetInstance().Start();
+
+	Util::StartupTrace::Scope scenePhase("MainMenuScene::Start");
 	m_CurrentScene = CreateScene(Scene::SceneType::Menu);
 
 	m_CurrentScene->Start();
@@ -115,10 +126,17 @@ std::shared_ptr<Scene> SceneManager::CreateScene(const Scene::SceneType type)
 	}
 }
 
-void SceneManager::Update() const { m_CurrentScene->Update(); }
+void SceneManager::Update() const
+{
+	ContentHotReload::GetInstance().Poll();
+	m_CurrentScene->Update();
+}
 
 void SceneManager::End()
 {
+	// 存檔在背景寫，關遊戲前等最後一次寫完
+	SaveManager::GetInstance().Flush();
+	ContentHotReload::GetInstance().Stop();
 	m_Data = nullptr;
 	m_CurrentScene->Exit();
 	m_CurrentScene = nullptr;
@@ -392,15 +392,17 @@ bool MinimapPanel::HasExploredNeighbor(const glm::ivec2 &gridPos)
 	int currentIndex = gridPos.y * 5 + gridPos.x;
 	const auto &currentRoomInfo = dungeonMap->GetRoomInfo(currentIndex);
 
-	// 如果當前位置沒有房間，檢查是否有相鄰已探索房間
+	// 如果當前位置的房間還沒建，檢查是否有相連的已探索房間
 	if (!currentRoomInfo.room)
 	{
-		// 檢查四個方向的相鄰房間
+		// 檢查四個方向的相鄰房間（順序同 Direction）
 		constexpr glm::ivec2 directions[] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
 
-		for (const auto &dir : directions)
+		for (int d = 0; d < 4; ++d)
 		{
-			glm::ivec2 neighborPos = gridPos + dir;
+			if (!currentRoomInfo.m_Connections[d])
+				continue;
+			glm::ivec2 neighborPos = gridPos + directions[d];
 
 			// 邊界檢查
 			if (neighborPos.x < 0 || neighborPos.x >= 5 || neighborPos.y < 0 || neighborPos.y >= 5)
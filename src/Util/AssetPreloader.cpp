@@ -0,0 +1,107 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Util/AssetPreloader.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include "Loader.hpp"
+#include "Util/AssetArchive.hpp"
+#include "Util/Image.hpp"
+#include "Util/Logger.hpp"
+#include "Util/StartupTrace.hpp"
+
+namespace Util
+{
+	AssetPreloader &AssetPreloader::GetInstance()
+	{
+		static AssetPreloader instance;
+		return instance;
+	}
+
+	void AssetPreloader::Start(const std::string &configPath)
+	{
+		StartupTrace::Scope scope("AssetPreloader::Start");
+
+		auto loader = std::make_shared<Loader>("Lobby");
+		const auto config = loader->readJsonFile(configPath);
+
+		// 大廳佈局只解析一次，結果留在RoomPrefabCache
+		m_LayoutTasks.push_back(std::async(std::launch::async,
+										   [loader]
+										   {
+											   StartupTrace::Scope layoutScope("Parse lobby layout");
+											   loader->LoadLobbyObjectPosition();
+										   }));
+
+		std::vector<std::string> paths;
+		const auto directories = config.is_object() ? config.value("images", nlohmann::ordered_json::array())
+													: nlohmann::ordered_json::array();
+		for (const auto &directory : directories)
+		{
+			// 路徑要和場景裏寫的一樣（RESOURCE_DIR "/MainMenu/Title.png"），快取才對得上
+			const std::string prefix = RESOURCE_DIR + directory.get<std::string>();
+			const std::filesystem::path root(prefix);
+			std::error_code error;
+			for (std::filesystem::recursive_directory_iterator it(root, error), end; !error && it != end;
+				 it.increment(error))
+			{
+				const auto extension = it->path().extension();
+				if (it->is_regular_file() && (extension == ".png" || extension == ".jpg"))
+					paths.push_back(prefix + "/" + it->path().lexically_relative(root).generic_string());
+			}
+		}
+		if (paths.empty())
+			return;
+
+		// 留一個核心給主執行緒建視窗
+		const size_t taskCount =
+			std::min<size_t>({std::max(std::thread::hardware_concurrency(), 2u) - 1, 4, paths.size()});
+		for (size_t task = 0; task < taskCount; ++task)
+		{
+			std::vector<std::string> slice;
+			for (size_t i = task; i < paths.size(); i += taskCount)
+				slice.push_back(paths[i]);
+
+			m_ImageTasks.push_back(std::async(std::launch::async,
+											  [slice = std::move(slice)]
+											  {
+												  StartupTrace::Scope decodeScope("Decode images");
+												  std::vector<DecodedImage> decoded;
+												  decoded.reserve(slice.size());
+												  for (const auto &path : slice)
+												  {
+													  std::shared_ptr<SDL_Surface> surface(
+														  AssetArchive::GetInstance().LoadImageSurface(path),
+														  SDL_FreeSurface);
+													  if (surface)
+														  decoded.emplace_back(path, std::move(surface));
+												  }
+												  return decoded;
+											  }));
+		}
+		LOG_INFO("AssetPreloader: decoding {} images on {} threads", paths.size(), taskCount);
+	}
+
+	void AssetPreloader::Install()
+	{
+		StartupTrace::Scope scope("AssetPreloader::Install");
+		size_t installed = 0;
+		for (auto &task : m_ImageTasks)
+		{
+			for (auto &[path, surface] : task.get())
+			{
+				Image::CacheSurface(path, std::move(surface));
+				++installed;
+			}
+		}
+		for (auto &task : m_LayoutTasks)
+			task.get();
+		m_ImageTasks.clear();
+		m_LayoutTasks.clear();
+		if (installed > 0)
+			LOG_DEBUG("AssetPreloader: installed {} images", installed);
+	}
+} // namespace Util
@@ -0,0 +1,324 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Util/ContentPack.hpp"
+
+#include <algorithm>
+#include "Util/Logger.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Util
+{
+	using namespace ContentPackFormat;
+
+	//============================= (ContentValue) =============================
+	bool ContentValue::IsNumber() const
+	{
+		return m_Node &&
+			(m_Node->type == NodeType::INTEGER || m_Node->type == NodeType::UNSIGNED || m_Node->type == NodeType::FLOAT);
+	}
+
+	size_t ContentValue::Size() const { return (IsArray() || IsObject()) ? m_Node->count : 0; }
+
+	ContentValue ContentValue::At(const size_t index) const
+	{
+		if (index >= Size())
+			return {};
+		return {m_Pack, m_Pack->m_Nodes + m_Node->offset + index};
+	}
+
+	ContentValue ContentValue::operator[](const std::string_view key) const
+	{
+		if (!IsObject())
+			return {};
+		// 物件通常只有十來個成員，線性比對比建索引划算
+		const Node *child = m_Pack->m_Nodes + m_Node->offset;
+		for (uint32_t i = 0; i < m_Node->count; ++i, ++child)
+			if (m_Pack->String(child->keyOffset, child->keyLength) == key)
+				return {m_Pack, child};
+		return {};
+	}
+
+	std::string_view ContentValue::Key() const
+	{
+		return m_Node ? m_Pack->String(m_Node->keyOffset, m_Node->keyLength) : std::string_view();
+	}
+
+	bool ContentValue::GetBool() const { return IsBool() && m_Node->boolean != 0; }
+
+	int64_t ContentValue::GetInt() const
+	{
+		if (!m_Node)
+			return 0;
+		switch (m_Node->type)
+		{
+		case NodeType::INTEGER:
+			return m_Node->integer;
+		case NodeType::UNSIGNED:
+			return static_cast<int64_t>(m_Node->unsignedInteger);
+		case NodeType::FLOAT:
+			return static_cast<int64_t>(m_Node->number);
+		default:
+			return 0;
+		}
+	}
+
+	double ContentValue::GetFloat() const
+	{
+		if (!m_Node)
+			return 0.0;
+		switch (m_Node->type)
+		{
+		case NodeType::INTEGER:
+			return static_cast<double>(m_Node->integer);
+		case NodeType::UNSIGNED:
+			return static_cast<double>(m_Node->unsignedInteger);
+		case NodeType::FLOAT:
+			return m_Node->number;
+		default:
+			return 0.0;
+		}
+	}
+
+	std::string_view ContentValue::GetString() const
+	{
+		return IsString() ? m_Pack->String(m_Node->offset, m_Node->count) : std::string_view();
+	}
+
+	template <typename JsonT>
+	JsonT ContentValue::ToJson() const
+	{
+		if (!m_Node)
+			return nullptr;
+		switch (m_Node->type)
+		{
+		case NodeType::NUL:
+			return nullptr;
+		case NodeType::BOOLEAN:
+			return GetBool();
+		case NodeType::INTEGER:
+			return m_Node->integer;
+		case NodeType::UNSIGNED:
+			return m_Node->unsignedInteger;
+		case NodeType::FLOAT:
+			return m_Node->number;
+		case NodeType::STRING:
+			return std::string(GetString());
+		case NodeType::ARRAY:
+		{
+			auto array = JsonT::array();
+			array.template get_ref<typename JsonT::array_t &>().reserve(m_Node->count);
+			for (size_t i = 0; i < m_Node->count; ++i)
+				array.push_back(At(i).ToJson<JsonT>());
+			return array;
+		}
+		case NodeType::OBJECT:
+		{
+			auto object = JsonT::object();
+			for (size_t i = 0; i < m_Node->count; ++i)
+			{
+				const ContentValue member = At(i);
+				object.emplace(std::string(member.Key()), member.ToJson<JsonT>());
+			}
+			return object;
+		}
+		}
+		return nullptr;
+	}
+
+	template nlohmann::json ContentValue::ToJson<nlohmann::json>() const;
+	template nlohmann::ordered_json ContentValue::ToJson<nlohmann::ordered_json>() const;
+
+	//============================= (ContentPack) =============================
+	ContentPack &ContentPack::GetInstance()
+	{
+		static ContentPack instance;
+#ifdef CONTENT_PACK_PATH
+		static const bool opened = instance.Open(CONTENT_PACK_PATH);
+		(void)opened;
+#endif
+		return instance;
+	}
+
+	ContentPack::~ContentPack() { Close(); }
+
+	bool ContentPack::Open(const std::string &filePath)
+	{
+		Close();
+#ifdef _WIN32
+		const HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+										FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+		LARGE_INTEGER fileSize;
+		const HANDLE mapping = GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0
+			? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)
+			: nullptr;
+		const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!view)
+		{
+			if (mapping)
+				CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+		m_FileHandle = file;
+		m_MappingHandle = mapping;
+		m_Size = static_cast<size_t>(fileSize.QuadPart);
+#else
+		const int fd = ::open(filePath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+		struct stat info{};
+		void *view = MAP_FAILED;
+		if (fstat(fd, &info) == 0 && info.st_size > 0)
+			view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd); // 映射建立後檔案描述子就不需要了
+		if (view == MAP_FAILED)
+			return false;
+		m_Size = static_cast<size_t>(info.st_size);
+#endif
+		m_Data = static_cast<const uint8_t *>(view);
+
+		// 驗證表頭與各區段範圍，不合就當作沒有內容包
+		m_Header = reinterpret_cast<const Header *>(m_Data);
+		// 先比位移再算結尾，位移很大時相加才不會溢位
+		const auto fits = [this](const uint64_t offset, const uint64_t size)
+		{ return offset <= m_Size && size <= m_Size - offset; };
+		bool valid = m_Size >= sizeof(Header) && m_Header->magic == MAGIC && m_Header->version == VERSION &&
+			m_Header->fileTableOffset % alignof(FileEntry) == 0 && m_Header->nodeTableOffset % alignof(Node) == 0 &&
+			m_Header->fileCount <= m_Size / sizeof(FileEntry) && m_Header->nodeCount <= m_Size / sizeof(Node) &&
+			fits(m_Header->fileTableOffset, uint64_t{m_Header->fileCount} * sizeof(FileEntry)) &&
+			fits(m_Header->nodeTableOffset, uint64_t{m_Header->nodeCount} * sizeof(Node)) &&
+			fits(m_Header->stringTableOffset, m_Header->stringTableSize);
+		if (valid)
+		{
+			m_Files = reinterpret_cast<const FileEntry *>(m_Data + m_Header->fileTableOffset);
+			m_Nodes = reinterpret_cast<const Node *>(m_Data + m_Header->nodeTableOffset);
+			m_Strings = reinterpret_cast<const char *>(m_Data + m_Header->stringTableOffset);
+			valid = ValidateTables();
+		}
+		if (!valid)
+		{
+			LOG_WARN("ContentPack: {} is not a valid version {} pack, falling back to json files", filePath, VERSION);
+			Close();
+			return false;
+		}
+		LOG_INFO("ContentPack: mapped {} ({} files, {} bytes)", filePath, m_Header->fileCount, m_Size);
+		return true;
+	}
+
+	bool ContentPack::ValidateTables() const
+	{
+		const uint64_t nodeCount = m_Header->nodeCount;
+		const uint64_t stringSize = m_Header->stringTableSize;
+		const auto inStrings = [stringSize](const uint64_t offset, const uint64_t length)
+		{ return offset <= stringSize && length <= stringSize - offset; };
+
+		for (const FileEntry *file = m_Files; file != m_Files + m_Header->fileCount; ++file)
+			if (file->root >= nodeCount || !inStrings(file->pathOffset, file->pathLength))
+				return false;
+
+		for (uint64_t index = 0; index < nodeCount; ++index)
+		{
+			const Node &node = m_Nodes[index];
+			if (!inStrings(node.keyOffset, node.keyLength))
+				return false;
+			switch (node.type)
+			{
+			case NodeType::NUL:
+			case NodeType::BOOLEAN:
+			case NodeType::INTEGER:
+			case NodeType::UNSIGNED:
+			case NodeType::FLOAT:
+				break;
+			case NodeType::STRING:
+				if (!inStrings(node.offset, node.count))
+					return false;
+				break;
+			case NodeType::ARRAY:
+			case NodeType::OBJECT:
+				// 子節點一定排在父節點之後（ContentPackBuilder就是這樣攤平的），也就不會有環讓ToJson遞迴不完
+				if (node.count > 0 &&
+					(node.offset <= index || node.offset > nodeCount || node.count > nodeCount - node.offset))
+					return false;
+				break;
+			default:
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void ContentPack::Close()
+	{
+		if (m_Data)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(m_Data);
+			CloseHandle(m_MappingHandle);
+			CloseHandle(m_FileHandle);
+			m_MappingHandle = nullptr;
+			m_FileHandle = nullptr;
+#else
+			munmap(const_cast<uint8_t *>(m_Data), m_Size);
+#endif
+		}
+		m_Data = nullptr;
+		m_Size = 0;
+		m_Header = nullptr;
+		m_Files = nullptr;
+		m_Nodes = nullptr;
+		m_Strings = nullptr;
+	}
+
+	ContentValue ContentPack::Find(std::string_view path) const
+	{
+		if (!m_Data)
+			return {};
+		path = ToPackPath(path);
+		if (m_HasOverrides.load(std::memory_order_acquire))
+		{
+			std::lock_guard lock(m_OverrideMutex);
+			if (m_Overridden.count(std::string(path)) > 0)
+				return {};
+		}
+
+		const uint64_t hash = HashPath(path);
+		const FileEntry *end = m_Files + m_Header->fileCount;
+		const FileEntry *it = std::lower_bound(m_Files, end, hash,
+											   [](const FileEntry &entry, const uint64_t value)
+											   { return entry.pathHash < value; });
+		for (; it != end && it->pathHash == hash; ++it)
+			if (String(it->pathOffset, it->pathLength) == path)
+				return {this, m_Nodes + it->root};
+		return {};
+	}
+
+	void ContentPack::Override(const std::string_view path)
+	{
+		std::lock_guard lock(m_OverrideMutex);
+		m_Overridden.emplace(ToPackPath(path));
+		m_HasOverrides.store(true, std::memory_order_release);
+	}
+
+	std::string_view ContentPack::ToPackPath(std::string_view path)
+	{
+#ifdef JSON_DIR
+		if (constexpr std::string_view jsonDir = JSON_DIR; path.substr(0, jsonDir.size()) == jsonDir)
+			path.remove_prefix(jsonDir.size());
+#endif
+		while (!path.empty() && (path.front() == '/' || path.front() == '\\'))
+			path.remove_prefix(1);
+		return path;
+	}
+} // namespace Util
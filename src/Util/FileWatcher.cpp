@@ -0,0 +1,141 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Util/FileWatcher.hpp"
+
+#include <filesystem>
+#include <unordered_map>
+#include "Util/Logger.hpp"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Util
+{
+	FileWatcher::FileWatcher(std::string rootDirectory, const std::chrono::milliseconds pollInterval) :
+		m_Root(std::move(rootDirectory)), m_PollInterval(pollInterval)
+	{
+		m_Thread = std::thread([this] { Run(); });
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		m_Stop = true;
+		if (m_Thread.joinable())
+			m_Thread.join();
+	}
+
+	std::vector<std::string> FileWatcher::TakeChanges()
+	{
+		std::lock_guard lock(m_Mutex);
+		std::vector<std::string> changes(m_Changes.begin(), m_Changes.end());
+		m_Changes.clear();
+		return changes;
+	}
+
+	void FileWatcher::Push(std::string relativePath)
+	{
+		std::lock_guard lock(m_Mutex);
+		m_Changes.insert(std::move(relativePath));
+	}
+
+#ifdef __linux__
+	void FileWatcher::Run()
+	{
+		const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (fd < 0)
+		{
+			LOG_ERROR("FileWatcher: inotify_init1 failed, {} is not watched", m_Root);
+			return;
+		}
+
+		// inotify不會遞迴，每個資料夾各掛一個watch；wd -> 相對路徑（根目錄是空字串）
+		std::unordered_map<int, std::string> directories;
+		constexpr uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+		const auto watch = [&](const std::string &relative)
+		{
+			const std::string path = relative.empty() ? m_Root : m_Root + "/" + relative;
+			if (const int wd = inotify_add_watch(fd, path.c_str(), mask | IN_ONLYDIR); wd >= 0)
+				directories[wd] = relative;
+		};
+		watch("");
+		std::error_code error;
+		for (std::filesystem::recursive_directory_iterator it(m_Root, error), end; !error && it != end;
+			 it.increment(error))
+			if (it->is_directory())
+				watch(it->path().lexically_relative(m_Root).generic_string());
+
+		alignas(inotify_event) char buffer[16 * 1024];
+		pollfd descriptor{fd, POLLIN, 0};
+		while (!m_Stop)
+		{
+			// 逾時只是爲了定期檢查m_Stop
+			if (poll(&descriptor, 1, static_cast<int>(m_PollInterval.count())) <= 0)
+				continue;
+			ssize_t length;
+			while ((length = read(fd, buffer, sizeof(buffer))) > 0)
+			{
+				for (char *p = buffer; p < buffer + length;)
+				{
+					const auto *event = reinterpret_cast<const inotify_event *>(p);
+					p += sizeof(inotify_event) + event->len;
+					const auto it = directories.find(event->wd);
+					if (it == directories.end() || event->len == 0)
+						continue;
+
+					const std::string relative = it->second.empty() ? event->name : it->second + "/" + event->name;
+					if (event->mask & IN_ISDIR)
+					{
+						if (event->mask & (IN_CREATE | IN_MOVED_TO))
+							watch(relative);
+					}
+					else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+					{
+						Push(relative);
+					}
+				}
+			}
+		}
+		close(fd);
+	}
+#else
+	void FileWatcher::Run()
+	{
+		// 沒有inotify的平台：定期比對每個檔案的修改時間
+		std::unordered_map<std::string, std::filesystem::file_time_type> snapshot;
+		const auto scan = [&](const bool report)
+		{
+			std::error_code error;
+			for (std::filesystem::recursive_directory_iterator it(m_Root, error), end; !error && it != end;
+				 it.increment(error))
+			{
+				if (!it->is_regular_file())
+					continue;
+				const auto time = it->last_write_time(error);
+				if (error)
+				{
+					error.clear();
+					continue;
+				}
+				std::string relative = it->path().lexically_relative(m_Root).generic_string();
+				auto [entry, inserted] = snapshot.try_emplace(relative, time);
+				if (!inserted && entry->second == time)
+					continue;
+				entry->second = time;
+				if (report)
+					Push(std::move(relative));
+			}
+		};
+		scan(false);
+		while (!m_Stop)
+		{
+			std::this_thread::sleep_for(m_PollInterval);
+			scan(true);
+		}
+	}
+#endif
+} // namespace Util
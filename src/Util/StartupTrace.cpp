@@ -0,0 +1,128 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Util/StartupTrace.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include "Util/Logger.hpp"
+#include "json.hpp"
+
+namespace Util
+{
+	namespace
+	{
+		std::string TracePathFromEnvironment()
+		{
+			const char *path = std::getenv("SOULKNIGHT_STARTUP_TRACE");
+			return path ? path : "";
+		}
+	} // namespace
+
+	StartupTrace::Scope::Scope(std::string name) : m_Name(std::move(name))
+	{
+		if (const auto &trace = GetInstance(); trace.IsRecording())
+			m_StartUs = trace.NowUs();
+	}
+
+	void StartupTrace::Scope::End()
+	{
+		if (m_StartUs < 0)
+			return;
+		auto &trace = GetInstance();
+		trace.Record(m_Name, m_StartUs, trace.NowUs());
+		m_StartUs = -1;
+	}
+
+	StartupTrace &StartupTrace::GetInstance()
+	{
+		static StartupTrace instance;
+		return instance;
+	}
+
+	StartupTrace::StartupTrace() :
+		m_Origin(std::chrono::steady_clock::now()), m_TracePath(TracePathFromEnvironment()),
+		m_Recording(!m_TracePath.empty())
+	{
+		m_Threads.emplace(std::this_thread::get_id(), 0);
+	}
+
+	int64_t StartupTrace::NowUs() const
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_Origin)
+			.count();
+	}
+
+	void StartupTrace::Record(const std::string &name, const int64_t startUs, const int64_t endUs)
+	{
+		if (!IsRecording())
+			return;
+		std::lock_guard lock(m_Mutex);
+		m_Events.push_back({name, 'X', startUs, endUs - startUs, ThreadIndex()});
+	}
+
+	void StartupTrace::Mark(const std::string &name)
+	{
+		if (!IsRecording())
+			return;
+		const int64_t now = NowUs();
+		std::lock_guard lock(m_Mutex);
+		m_Events.push_back({name, 'i', now, 0, ThreadIndex()});
+	}
+
+	void StartupTrace::Finish()
+	{
+		if (m_Finished.exchange(true))
+			return;
+		m_Recording = false;
+		const int64_t totalUs = NowUs();
+		LOG_INFO("Startup finished in {:.1f} ms", static_cast<double>(totalUs) / 1000.0);
+		if (m_TracePath.empty())
+			return;
+
+		std::lock_guard lock(m_Mutex);
+		nlohmann::json events = nlohmann::json::array();
+		for (const auto &[id, index] : m_Threads)
+			events.push_back({{"name", "thread_name"},
+							  {"ph", "M"},
+							  {"pid", 1},
+							  {"tid", index},
+							  {"args", {{"name", index == 0 ? "main" : "worker " + std::to_string(index)}}}});
+		for (const auto &event : m_Events)
+		{
+			nlohmann::json entry = {{"name", event.name},
+									{"ph", std::string(1, event.phase)},
+									{"ts", event.startUs},
+									{"pid", 1},
+									{"tid", event.thread}};
+			if (event.phase == 'X')
+				entry["dur"] = event.durationUs;
+			else
+				entry["s"] = "g";
+			events.push_back(std::move(entry));
+		}
+		events.push_back({{"name", "First frame"}, {"ph", "i"}, {"ts", totalUs}, {"pid", 1}, {"tid", 0}, {"s", "g"}});
+
+		// 主執行緒上的各階段順便印在log
+		for (const auto &event : m_Events)
+			if (event.phase == 'X' && event.thread == 0)
+				LOG_INFO("  {:<32} {:>8.1f} ms", event.name, static_cast<double>(event.durationUs) / 1000.0);
+
+		std::ofstream file(m_TracePath);
+		if (!file.is_open())
+		{
+			LOG_WARN("StartupTrace: cannot write {}", m_TracePath);
+			return;
+		}
+		file << nlohmann::json{{"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"}}.dump();
+		LOG_INFO("StartupTrace: wrote {}", m_TracePath);
+	}
+
+	uint32_t StartupTrace::ThreadIndex()
+	{
+		const auto [it, inserted] =
+			m_Threads.emplace(std::this_thread::get_id(), static_cast<uint32_t>(m_Threads.size()));
+		return it->second;
+	}
+} // namespace Util
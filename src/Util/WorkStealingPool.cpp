@@ -0,0 +1,139 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+#include "Util/WorkStealingPool.hpp"
+
+#include <algorithm>
+
+namespace Util
+{
+	WorkStealingPool &WorkStealingPool::GetInstance()
+	{
+		// AI批次不大，工作執行緒太多只會增加喚醒成本
+		static WorkStealingPool pool(std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u) - 1, 7));
+		return pool;
+	}
+
+	WorkStealingPool::WorkStealingPool(const std::size_t workerCount)
+	{
+		m_Queues.reserve(workerCount + 1);
+		for (std::size_t i = 0; i < workerCount + 1; ++i)
+			m_Queues.push_back(std::make_unique<WorkQueue>());
+
+		m_Workers.reserve(workerCount);
+		for (std::size_t i = 0; i < workerCount; ++i)
+			m_Workers.emplace_back([this, i] { WorkerLoop(i); });
+	}
+
+	WorkStealingPool::~WorkStealingPool()
+	{
+		m_Stop.store(true);
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+		}
+		m_WakeCondition.notify_all();
+		for (auto &worker : m_Workers)
+		{
+			if (worker.joinable())
+				worker.join();
+		}
+	}
+
+	void WorkStealingPool::ParallelFor(const std::size_t count, const std::size_t grain, const RangeFunc &func)
+	{
+		if (count == 0)
+			return;
+		const std::size_t chunkSize = std::max<std::size_t>(grain, 1);
+		if (m_Workers.empty() || count <= chunkSize)
+		{
+			func(0, count);
+			return;
+		}
+
+		const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+		Job job;
+		job.func = &func;
+		job.remaining.store(chunkCount);
+
+		// 先記帳再放進佇列：塊一被看見就可能有人做完並扣掉，先扣會讓計數繞回最大值
+		m_Pending.fetch_add(chunkCount);
+		// 平均分到每個佇列（含呼叫端自己的）
+		for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			const std::size_t begin = chunk * chunkSize;
+			auto &queue = *m_Queues[chunk % m_Queues.size()];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back({&job, begin, std::min(begin + chunkSize, count)});
+		}
+		{
+			// 先鎖再通知，避免工作執行緒檢查完條件、還沒睡下就錯過通知
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+		}
+		m_WakeCondition.notify_all();
+
+		// 呼叫端一起做，直到所有塊都完成
+		const std::size_t callerIndex = m_Queues.size() - 1;
+		while (job.remaining.load(std::memory_order_acquire) > 0)
+		{
+			Task task;
+			if (PopLocal(callerIndex, task) || Steal(callerIndex, task))
+				Run(task);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	void WorkStealingPool::WorkerLoop(const std::size_t index)
+	{
+		while (true)
+		{
+			Task task;
+			if (PopLocal(index, task) || Steal(index, task))
+			{
+				Run(task);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_WakeCondition.wait(lock, [this] { return m_Stop.load() || m_Pending.load() > 0; });
+			if (m_Stop.load())
+				return;
+		}
+	}
+
+	bool WorkStealingPool::PopLocal(const std::size_t index, Task &task)
+	{
+		auto &queue = *m_Queues[index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty())
+			return false;
+		task = queue.tasks.front();
+		queue.tasks.pop_front();
+		m_Pending.fetch_sub(1);
+		return true;
+	}
+
+	bool WorkStealingPool::Steal(const std::size_t thiefIndex, Task &task)
+	{
+		const std::size_t queueCount = m_Queues.size();
+		for (std::size_t offset = 1; offset < queueCount; ++offset)
+		{
+			auto &queue = *m_Queues[(thiefIndex + offset) % queueCount];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.tasks.empty())
+				continue;
+			task = queue.tasks.back();
+			queue.tasks.pop_back();
+			m_Pending.fetch_sub(1);
+			return true;
+		}
+		return false;
+	}
+
+	void WorkStealingPool::Run(const Task &task)
+	{
+		(*task.job->func)(task.begin, task.end);
+		task.job->remaining.fetch_sub(1, std::memory_order_release);
+	}
+} // namespace Util
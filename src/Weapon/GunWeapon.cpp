@@ -22,18 +22,21 @@ void GunWeapon::attack(const int damage, bool isCriticalHit)
 {
 	ResetAttackTimer(); // 重置冷卻
 
-	// 播放對應的槍械音效
+	// 播放對應的槍械音效（每發子彈都會播，代號只查一次）
+	static const SFXHandle s_PistolSFX = AudioManager::GetInstance().GetSFXHandle("gun_pistol");
+	static const SFXHandle s_ShotgunSFX = AudioManager::GetInstance().GetSFXHandle("gun_shotgun");
+	static const SFXHandle s_RocketSFX = AudioManager::GetInstance().GetSFXHandle("gun_rocket");
 	switch (m_weaponType)
 	{
 	case WeaponType::PISTOL:
 	case WeaponType::RIFLE:
-		AudioManager::GetInstance().PlaySFX("gun_pistol");
+		AudioManager::GetInstance().PlaySFX(s_PistolSFX);
 		break;
 	case WeaponType::SHOTGUN:
-		AudioManager::GetInstance().PlaySFX("gun_shotgun");
+		AudioManager::GetInstance().PlaySFX(s_ShotgunSFX);
 		break;
 	case WeaponType::ROCKET_LAUNCHER:
-		AudioManager::GetInstance().PlaySFX("gun_rocket");
+		AudioManager::GetInstance().PlaySFX(s_RocketSFX);
 		break;
 	default:
 		// 其他槍械類型暫時不播放特定音效
@@ -21,14 +21,16 @@ void MeleeWeapon::attack(int damage, bool isCriticalHit)
 	ResetAttackTimer(); // 重置冷卻
 
 	// 根據武器名稱播放對應的音效
+	static const SFXHandle s_LaserSwordSFX = AudioManager::GetInstance().GetSFXHandle("laser_sword");
+	static const SFXHandle s_HandSwordSFX = AudioManager::GetInstance().GetSFXHandle("hand_sword");
 	const std::string &weaponName = GetName();
 	if (weaponName.find("Light_saber") != std::string::npos)
 	{
-		AudioManager::GetInstance().PlaySFX("laser_sword");
+		AudioManager::GetInstance().PlaySFX(s_LaserSwordSFX);
 	}
 	else
 	{
-		AudioManager::GetInstance().PlaySFX("hand_sword");
+		AudioManager::GetInstance().PlaySFX(s_HandSwordSFX);
 	}
 
 	// 原始旋轉角度
@@ -3,14 +3,30 @@
 
 #include <iostream>
 #include "Core/Context.hpp"
+#include "Util/AssetArchive.hpp"
+#include "Util/AssetPreloader.hpp"
+#include "Util/StartupTrace.hpp"
 
 int main(int, char**) {
+	// 啟動計時從這裏開始
+	auto &startupTrace = Util::StartupTrace::GetInstance();
+#ifdef ASSET_ARCHIVE_PATH
+	// 圖片優先從封存檔讀，沒有封存檔就照舊逐檔讀取
+	Util::AssetArchive::GetInstance().Mount(ASSET_ARCHIVE_PATH, RESOURCE_DIR);
+#endif
+	// 建視窗和GL環境的同時，背景先解碼主選單和大廳的圖片
+	IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG);
+	Util::AssetPreloader::GetInstance().Start(JSON_DIR "/StartupPreload.json");
+
+	Util::StartupTrace::Scope contextPhase("Core::Context (SDL/GL init)");
     auto context = Core::Context::GetInstance();
 	context->SetWindowIcon(RESOURCE_DIR "/pet00icon.png");
+	contextPhase.End();
 	App app;
 
 	while (!context->GetExit()) {
-		switch (app.GetCurrentState()) {
+		const auto state = app.GetCurrentState();
+		switch (state) {
 		case App::State::START:
 			app.Start();
 			break;
@@ -27,6 +43,9 @@ int main(int, char**) {
 		{
 			context->Update();
 		}
+		// 第一個遊戲畫面送出後印出啟動時間（只印一次；有開trace才寫檔）
+		if (state == App::State::UPDATE)
+			startupTrace.Finish();
 	}
 
     return 0;
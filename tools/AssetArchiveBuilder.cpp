@@ -0,0 +1,126 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+// 離線工具：把 Resources/ 底下的圖片打包成一個資產封存檔（格式見 PTSD Util/AssetArchiveFormat.hpp）
+// 用法：AssetArchiveBuilder <Resources目錄> <輸出檔>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Util/AssetArchiveFormat.hpp"
+
+namespace
+{
+	using namespace Util::AssetArchiveFormat;
+
+	// 只收IMG_Load會讀的圖片；音效由SDL_mixer直接讀檔
+	bool IsImage(std::string extension)
+	{
+		std::transform(extension.begin(), extension.end(), extension.begin(),
+					   [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".gif" ||
+			extension == ".bmp";
+	}
+
+	uint64_t AlignUp(const uint64_t value) { return (value + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT; }
+} // namespace
+
+int main(const int argc, char **argv)
+{
+	if (argc != 3)
+	{
+		std::cerr << "usage: AssetArchiveBuilder <resource dir> <output file>\n";
+		return 2;
+	}
+	const std::filesystem::path root(argv[1]);
+	const std::string outputPath(argv[2]);
+
+	struct Source
+	{
+		std::filesystem::path file;
+		std::string path;
+		uint64_t size = 0;
+	};
+	std::vector<Source> sources;
+	for (const auto &entry : std::filesystem::recursive_directory_iterator(root))
+	{
+		if (!entry.is_regular_file() || !IsImage(entry.path().extension().string()))
+			continue;
+		sources.push_back({entry.path(), std::filesystem::relative(entry.path(), root).generic_u8string(),
+						   static_cast<uint64_t>(entry.file_size())});
+	}
+	// 資料依路徑排序：同一個資料夾的檔案連在一起，切主題時可以一次循序預讀
+	std::sort(sources.begin(), sources.end(), [](const Source &a, const Source &b) { return a.path < b.path; });
+
+	Header header;
+	header.entryCount = static_cast<uint32_t>(sources.size());
+	header.entryTableOffset = sizeof(Header);
+	header.pathTableOffset = header.entryTableOffset + sources.size() * sizeof(Entry);
+
+	std::string pathTable;
+	std::vector<Entry> entries;
+	entries.reserve(sources.size());
+	for (const auto &source : sources)
+	{
+		Entry entry;
+		entry.pathHash = HashPath(source.path);
+		entry.pathOffset = static_cast<uint32_t>(pathTable.size());
+		entry.pathLength = static_cast<uint32_t>(source.path.size());
+		entry.dataSize = source.size;
+		pathTable += source.path;
+		entries.push_back(entry);
+	}
+	header.pathTableSize = pathTable.size();
+
+	uint64_t dataOffset = AlignUp(header.pathTableOffset + header.pathTableSize);
+	for (auto &entry : entries)
+	{
+		entry.dataOffset = dataOffset;
+		dataOffset = AlignUp(dataOffset + entry.dataSize);
+	}
+	const std::vector<Entry> dataOrder = entries; // 寫資料用路徑順序，索引表用雜湊順序
+	std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.pathHash < b.pathHash; });
+
+	std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		std::cerr << "AssetArchiveBuilder: cannot write " << outputPath << '\n';
+		return 1;
+	}
+	out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char *>(entries.data()),
+			  static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+	out.write(pathTable.data(), static_cast<std::streamsize>(pathTable.size()));
+
+	const std::array<char, DATA_ALIGNMENT> padding{};
+	std::vector<char> buffer;
+	for (size_t i = 0; i < sources.size(); ++i)
+	{
+		const auto position = static_cast<uint64_t>(out.tellp());
+		out.write(padding.data(), static_cast<std::streamsize>(dataOrder[i].dataOffset - position));
+
+		std::ifstream in(sources[i].file, std::ios::binary);
+		buffer.resize(static_cast<size_t>(sources[i].size));
+		if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+		{
+			std::cerr << "AssetArchiveBuilder: cannot read " << sources[i].file << '\n';
+			return 1;
+		}
+		out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+	if (!out)
+	{
+		std::cerr << "AssetArchiveBuilder: write failed " << outputPath << '\n';
+		return 1;
+	}
+	std::cout << "AssetArchiveBuilder: " << sources.size() << " images, " << dataOffset << " bytes -> " << outputPath
+			  << '\n';
+	return 0;
+}
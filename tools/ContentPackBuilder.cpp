@@ -0,0 +1,207 @@
+//
+// Created by QuzzS on 2026/10/19.
+//
+
+// 離線工具：把 json/ 底下所有 .json 驗證後編譯成一個二進位內容包（格式見 Util/ContentPack.hpp）
+// 用法：ContentPackBuilder <json目錄> <輸出檔>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "Util/ContentPack.hpp"
+
+namespace
+{
+	using namespace Util::ContentPackFormat;
+	using Json = nlohmann::ordered_json;
+
+	class PackWriter
+	{
+	public:
+		void AddFile(const std::string &relativePath, const Json &root)
+		{
+			FileEntry entry;
+			entry.pathHash = HashPath(relativePath);
+			entry.pathOffset = Intern(relativePath);
+			entry.pathLength = static_cast<uint32_t>(relativePath.size());
+			entry.root = static_cast<uint32_t>(m_Nodes.size());
+			m_Nodes.emplace_back();
+			Fill(entry.root, root);
+			m_Files.push_back(entry);
+		}
+
+		bool Write(const std::string &outputPath)
+		{
+			std::sort(m_Files.begin(), m_Files.end(),
+					  [](const FileEntry &a, const FileEntry &b) { return a.pathHash < b.pathHash; });
+
+			Header header;
+			header.fileCount = static_cast<uint32_t>(m_Files.size());
+			header.nodeCount = static_cast<uint32_t>(m_Nodes.size());
+			header.fileTableOffset = sizeof(Header);
+			header.nodeTableOffset = header.fileTableOffset + m_Files.size() * sizeof(FileEntry);
+			header.stringTableOffset = header.nodeTableOffset + m_Nodes.size() * sizeof(Node);
+			header.stringTableSize = m_Strings.size();
+
+			std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+			if (!out)
+				return false;
+			out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+			out.write(reinterpret_cast<const char *>(m_Files.data()),
+					  static_cast<std::streamsize>(m_Files.size() * sizeof(FileEntry)));
+			out.write(reinterpret_cast<const char *>(m_Nodes.data()),
+					  static_cast<std::streamsize>(m_Nodes.size() * sizeof(Node)));
+			out.write(m_Strings.data(), static_cast<std::streamsize>(m_Strings.size()));
+			return static_cast<bool>(out);
+		}
+
+		[[nodiscard]] size_t GetNodeCount() const { return m_Nodes.size(); }
+		[[nodiscard]] size_t GetStringBytes() const { return m_Strings.size(); }
+
+	private:
+		uint32_t Intern(const std::string &text)
+		{
+			if (const auto it = m_StringOffsets.find(text); it != m_StringOffsets.end())
+				return it->second;
+			const auto offset = static_cast<uint32_t>(m_Strings.size());
+			m_Strings.insert(m_Strings.end(), text.begin(), text.end());
+			m_StringOffsets.emplace(text, offset);
+			return offset;
+		}
+
+		// 節點先佔位再填：子節點要連續，所以先一次配好一整排再往下遞迴
+		void Fill(const size_t index, const Json &value)
+		{
+			Node node = m_Nodes[index];
+			switch (value.type())
+			{
+			case Json::value_t::null:
+			case Json::value_t::discarded:
+				node.type = NodeType::NUL;
+				break;
+			case Json::value_t::boolean:
+				node.type = NodeType::BOOLEAN;
+				node.boolean = value.get<bool>() ? 1 : 0;
+				break;
+			case Json::value_t::number_integer:
+				node.type = NodeType::INTEGER;
+				node.integer = value.get<int64_t>();
+				break;
+			case Json::value_t::number_unsigned:
+				node.type = NodeType::UNSIGNED;
+				node.unsignedInteger = value.get<uint64_t>();
+				break;
+			case Json::value_t::number_float:
+				node.type = NodeType::FLOAT;
+				node.number = value.get<double>();
+				break;
+			case Json::value_t::string:
+			{
+				const auto &text = value.get_ref<const std::string &>();
+				node.type = NodeType::STRING;
+				node.offset = Intern(text);
+				node.count = static_cast<uint32_t>(text.size());
+				break;
+			}
+			case Json::value_t::binary:
+				throw std::runtime_error("binary values are not supported");
+			case Json::value_t::array:
+			case Json::value_t::object:
+			{
+				const bool isObject = value.is_object();
+				node.type = isObject ? NodeType::OBJECT : NodeType::ARRAY;
+				node.count = static_cast<uint32_t>(value.size());
+				node.offset = m_Nodes.size();
+				m_Nodes.resize(m_Nodes.size() + value.size());
+				size_t child = node.offset;
+				for (auto it = value.begin(); it != value.end(); ++it, ++child)
+				{
+					if (isObject)
+					{
+						m_Nodes[child].keyOffset = Intern(it.key());
+						m_Nodes[child].keyLength = static_cast<uint32_t>(it.key().size());
+					}
+					Fill(child, it.value());
+				}
+				break;
+			}
+			}
+			m_Nodes[index] = node;
+		}
+
+		std::vector<FileEntry> m_Files;
+		std::vector<Node> m_Nodes;
+		std::vector<char> m_Strings;
+		std::unordered_map<std::string, uint32_t> m_StringOffsets;
+	};
+
+	// 內容檢查：頂層是物件陣列且帶"ID"的檔案（enemy.json、weapon.json…），重複的ID只有第一個會被用到
+	void WarnDuplicateIds(const std::string &relativePath, const Json &root)
+	{
+		if (!root.is_array())
+			return;
+		std::set<int64_t> ids;
+		for (const auto &item : root)
+		{
+			if (!item.is_object() || !item.contains("ID") || !item["ID"].is_number_integer())
+				continue;
+			if (const int64_t id = item["ID"].get<int64_t>(); !ids.insert(id).second)
+				std::cerr << relativePath << ": warning: duplicate ID " << id << ", only the first entry is used\n";
+		}
+	}
+} // namespace
+
+int main(const int argc, char **argv)
+{
+	if (argc != 3)
+	{
+		std::cerr << "usage: ContentPackBuilder <json dir> <output file>\n";
+		return 2;
+	}
+	const std::filesystem::path root(argv[1]);
+	const std::string outputPath(argv[2]);
+
+	// 依路徑排序，讓同樣的輸入產生同樣的內容包
+	std::vector<std::filesystem::path> files;
+	for (const auto &entry : std::filesystem::recursive_directory_iterator(root))
+		if (entry.is_regular_file() && entry.path().extension() == ".json")
+			files.push_back(entry.path());
+	std::sort(files.begin(), files.end());
+
+	PackWriter writer;
+	bool ok = true;
+	for (const auto &file : files)
+	{
+		const std::string relativePath = std::filesystem::relative(file, root).generic_u8string();
+		std::ifstream in(file, std::ios::binary);
+		try
+		{
+			const Json document = Json::parse(in);
+			WarnDuplicateIds(relativePath, document);
+			writer.AddFile(relativePath, document);
+		}
+		catch (const std::exception &e)
+		{
+			std::cerr << relativePath << ": " << e.what() << '\n';
+			ok = false;
+		}
+	}
+	if (!ok)
+	{
+		std::cerr << "ContentPackBuilder: validation failed, " << outputPath << " not written\n";
+		return 1;
+	}
+	if (!writer.Write(outputPath))
+	{
+		std::cerr << "ContentPackBuilder: cannot write " << outputPath << '\n';
+		return 1;
+	}
+	std::cout << "ContentPackBuilder: " << files.size() << " files, " << writer.GetNodeCount() << " nodes, "
+			  << writer.GetStringBytes() << " string bytes -> " << outputPath << '\n';
+	return 0;
+}